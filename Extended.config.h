@@ -34,6 +34,7 @@
                                           // OFF: do not wait, n: wait n seconds, ON: wait forever for serial monitor connect.
 #define DEBUG_SERVO                   OFF //    OFF, n. Where n=1 to 9 as the designated axis for logging servo activity.     Option
 #define DEBUG_ECHO_COMMANDS           ON  //    OFF, Use ON or ERRORS_ONLY to log commands to the debug serial port.          Option
+#define DEBUG_COMMAND_STATS           OFF //    OFF, Use ON to log commands/second and reply latency percentiles every 10s.   Option
 #define SERIAL_DEBUG               Serial // Serial (For Teensy this is USB serial, baud ignored), Use any available h/w serial port. Serial1 or Serial2, etc.              Option
 #define SERIAL_DEBUG_BAUD          230400 // 230400, n. Where n=9600,19200,57600,115200,230400,460800 (common baud rates.)    Option
                                           // No effect when SERIAL_DEBUG = Serial (for Teensy USB serial monitor channel)
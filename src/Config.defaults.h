@@ -19,6 +19,9 @@
 #ifndef DEBUG_ECHO_COMMANDS
 #define DEBUG_ECHO_COMMANDS           OFF
 #endif
+#ifndef DEBUG_COMMAND_STATS
+#define DEBUG_COMMAND_STATS           OFF
+#endif
 #ifndef SERIAL_DEBUG
 #define SERIAL_DEBUG                  Serial
 #endif
@@ -282,7 +285,7 @@
   #define AXIS1_SERVO_ACCELERATION      20                        // acceleration, in %/s for DC, in steps/s/s for SERVO_TMC2209
   #endif
   #ifndef AXIS1_SERVO_FEEDBACK
-  #define AXIS1_SERVO_FEEDBACK          FB_PID                    // type of feedback: FB_PID
+  #define AXIS1_SERVO_FEEDBACK          FB_PID                    // type of feedback: FB_PID or FB_CASCADE
   #endif
 
   #ifndef AXIS1_PID_P
@@ -306,6 +309,27 @@
   #ifndef AXIS1_PID_SENSITIVITY
   #define AXIS1_PID_SENSITIVITY         0                         // 0 to use slewing state, or % power for 100% pid set two (_GOTO)
   #endif
+  #ifndef AXIS1_CASCADE_P
+  #define AXIS1_CASCADE_P               10.0                      // P = position loop proportional, velocity (counts/s) per count of error
+  #endif
+  #ifndef AXIS1_CASCADE_VP
+  #define AXIS1_CASCADE_VP              0.1                       // VP = velocity loop proportional
+  #endif
+  #ifndef AXIS1_CASCADE_VI
+  #define AXIS1_CASCADE_VI              1.0                       // VI = velocity loop integral
+  #endif
+  #ifndef AXIS1_CASCADE_P_GOTO
+  #define AXIS1_CASCADE_P_GOTO          AXIS1_CASCADE_P           // P = position loop proportional
+  #endif
+  #ifndef AXIS1_CASCADE_VP_GOTO
+  #define AXIS1_CASCADE_VP_GOTO         AXIS1_CASCADE_VP          // VP = velocity loop proportional
+  #endif
+  #ifndef AXIS1_CASCADE_VI_GOTO
+  #define AXIS1_CASCADE_VI_GOTO         AXIS1_CASCADE_VI          // VI = velocity loop integral
+  #endif
+  #ifndef AXIS1_CASCADE_ACCEL_FF
+  #define AXIS1_CASCADE_ACCEL_FF        0.0                       // acceleration feedforward, output per count/s/s of commanded acceleration
+  #endif
 
   #ifndef AXIS1_ENCODER
   #define AXIS1_ENCODER                 AB                        // type of encoder: AB, CW_CCW, PULSE_DIR, PULSE_ONLY, SERIAL_BRIDGE
@@ -471,6 +495,27 @@
   #ifndef AXIS2_PID_SENSITIVITY
   #define AXIS2_PID_SENSITIVITY         0
   #endif
+  #ifndef AXIS2_CASCADE_P
+  #define AXIS2_CASCADE_P               10.0
+  #endif
+  #ifndef AXIS2_CASCADE_VP
+  #define AXIS2_CASCADE_VP              0.1
+  #endif
+  #ifndef AXIS2_CASCADE_VI
+  #define AXIS2_CASCADE_VI              1.0
+  #endif
+  #ifndef AXIS2_CASCADE_P_GOTO
+  #define AXIS2_CASCADE_P_GOTO          AXIS2_CASCADE_P
+  #endif
+  #ifndef AXIS2_CASCADE_VP_GOTO
+  #define AXIS2_CASCADE_VP_GOTO         AXIS2_CASCADE_VP
+  #endif
+  #ifndef AXIS2_CASCADE_VI_GOTO
+  #define AXIS2_CASCADE_VI_GOTO         AXIS2_CASCADE_VI
+  #endif
+  #ifndef AXIS2_CASCADE_ACCEL_FF
+  #define AXIS2_CASCADE_ACCEL_FF        0.0
+  #endif
 
   #ifndef AXIS2_ENCODER
   #define AXIS2_ENCODER                 AB
@@ -690,6 +735,18 @@
 #ifndef GUIDE_SEPARATE_PULSE_RATE
 #define GUIDE_SEPARATE_PULSE_RATE     ON                          // normally always enabled
 #endif
+#ifndef GUIDE_PULSE_OFFSET
+#define GUIDE_PULSE_OFFSET            OFF                         // ON moves the motor target by each pulse guide's exact distance
+#endif
+#ifndef AXIS1_GUIDE_OFFSET_LIMIT
+#define AXIS1_GUIDE_OFFSET_LIMIT      30                          // in arc-seconds, larger pulse guides are done by rate
+#endif
+#ifndef AXIS2_GUIDE_OFFSET_LIMIT
+#define AXIS2_GUIDE_OFFSET_LIMIT      30                          // in arc-seconds, larger pulse guides are done by rate
+#endif
+#ifndef GUIDE_PREDICT
+#define GUIDE_PREDICT                 OFF                         // ON learns periodic error and drift from pulse guides
+#endif
 
 // tracking
 #ifndef TRACK_AUTOSTART
@@ -143,7 +143,7 @@
 #define SERIAL_ST4_SERVER_PRESENT
 
 // NV -------------------------------------------------------------------------------------------------------------------
-#define INIT_NV_KEY                 583928936UL
+#define INIT_NV_KEY                 583928937UL
 
 #define NV_KEY                      0      // bytes: 4   , 4
 #define NV_SITE_NUMBER              4      // bytes: 1   , 1
@@ -167,5 +167,6 @@
 #define NV_ROTATOR_SETTINGS_BASE    806    // bytes: 11  , 11
 #define NV_FEATURE_SETTINGS_BASE    817    // bytes: 3 *8, 24
 #define NV_TELESCOPE_SETTINGS_BASE  841    // bytes: 2   , 2
+#define NV_MOUNT_HORIZON_BASE       843    // bytes: 36  , 36
 
-#define NV_LAST                     842
+#define NV_LAST                     878
@@ -26,6 +26,14 @@
 #endif
 #define HAL_PULSE_WIDTH 200  // in ns, measured 1/18/22 (ESP32 v2.0.0)
 
+// Fast step pin writes using the GPIO write 1 to set/clear registers (GPIO0 to GPIO31)
+#include "soc/gpio_reg.h"
+#define HAL_HAS_FAST_PIN_REGISTERS
+#define HAL_FAST_PIN_SET_REG(pin)  ((pin) < 32 ? (volatile uint32_t *)GPIO_OUT_W1TS_REG : NULL)
+#define HAL_FAST_PIN_SET_MASK(pin) (1UL << ((pin) & 31))
+#define HAL_FAST_PIN_CLR_REG(pin)  ((pin) < 32 ? (volatile uint32_t *)GPIO_OUT_W1TC_REG : NULL)
+#define HAL_FAST_PIN_CLR_MASK(pin) (1UL << ((pin) & 31))
+
 // New symbol for the default I2C port -------------------------------------------------------------
 #include <Wire.h>
 #define HAL_Wire Wire
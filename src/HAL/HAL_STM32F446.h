@@ -24,6 +24,13 @@
 #define HAL_MAXRATE_LOWER_LIMIT 14   // assumes optimization set to Fastest (-O3)
 #define HAL_PULSE_WIDTH         250  // in ns, estimated
 
+// Fast step pin writes using the GPIO bit set/reset register
+#define HAL_HAS_FAST_PIN_REGISTERS
+#define HAL_FAST_PIN_SET_REG(pin)  ((volatile uint32_t *)&(digitalPinToPort(pin)->BSRR))
+#define HAL_FAST_PIN_SET_MASK(pin) ((uint32_t)digitalPinToBitMask(pin))
+#define HAL_FAST_PIN_CLR_REG(pin)  ((volatile uint32_t *)&(digitalPinToPort(pin)->BSRR))
+#define HAL_FAST_PIN_CLR_MASK(pin) ((uint32_t)digitalPinToBitMask(pin) << 16)
+
 #include <HardwareTimer.h>
 
 // Interrupts
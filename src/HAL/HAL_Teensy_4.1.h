@@ -30,6 +30,13 @@
 #define HAL_FAST_PROCESSOR
 #define HAL_VFAST_PROCESSOR
 
+// Fast step pin writes using the GPIO set/clear registers
+#define HAL_HAS_FAST_PIN_REGISTERS
+#define HAL_FAST_PIN_SET_REG(pin)  ((volatile uint32_t *)portSetRegister(pin))
+#define HAL_FAST_PIN_SET_MASK(pin) ((uint32_t)digitalPinToBitMask(pin))
+#define HAL_FAST_PIN_CLR_REG(pin)  ((volatile uint32_t *)portClearRegister(pin))
+#define HAL_FAST_PIN_CLR_MASK(pin) ((uint32_t)digitalPinToBitMask(pin))
+
 // New symbol for the default I2C port -------------------------------------------------------------
 #include <Wire.h>
 #define HAL_Wire Wire
@@ -25,6 +25,7 @@
 #define PERSISTENT                  -20
 #define ERRORS_ONLY                 -21
 #define KALMAN                      -22
+#define ALPHA_BETA                  -23
 #define INVALID                     -127
 
 // driver (step/dir interface, usually for stepper motors)
@@ -90,7 +91,8 @@
 // servo feedback (must match Encoder library)
 #define SERVO_FEEDBACK_FIRST        1
 #define FB_PID                      1      // PID feedback
-#define SERVO_FEEDBACK_LAST         1
+#define FB_CASCADE                  2      // cascaded position/velocity feedback
+#define SERVO_FEEDBACK_LAST         2
 
 // driver (step/dir) and servo, misc.
 #define ODRIVER                     -10    // general purpose flag for a ODRIVE driver motor
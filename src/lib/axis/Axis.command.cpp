@@ -69,6 +69,41 @@ bool Axis::command(char *reply, char *command, char *parameter, bool *supressFra
         sprintf(reply, "%ld,%s", ((ServoMotor*)motor)->delta, temp);
         *numericReply = false;
       } else
+
+      // :GXT[n]#   Get axis servo autotune state, RMS tracking error (in counts) and proposed PID parameters
+      //            Returns: s,rms,p,i,d,p_goto,i_goto,d_goto where s is 0=idle, 1=running, 2=done, 3=failed
+      if (parameter[0] == 'T') {
+        int index = parameter[1] - '1';
+        if (index > 8) { *commandError = CE_PARAM_RANGE; return true; }
+        if (index + 1 != axisNumber) return false; // command wasn't processed
+        if (motor->driverType != SERVO) { *commandError = CE_CMD_UNKNOWN; return true; } // not a servo
+
+        ServoMotor *servo = (ServoMotor*)motor;
+        float p[6] = {0, 0, 0, 0, 0, 0};
+        servo->autotune.getParameters(&p[0], &p[1], &p[2], &p[3], &p[4], &p[5]);
+        char temp[20];
+        sprintF(temp, "%1.3f", servo->getTrackingErrorRms());
+        sprintf(reply, "%d,%s", (int)servo->autotune.state, temp);
+        for (int i = 0; i < 6; i++) {
+          sprintF(temp, ",%1.3f", p[i]);
+          strcat(reply, temp);
+        }
+        *numericReply = false;
+      } else
+    #endif
+
+    #ifdef LOAD_TELEMETRY_PRESENT
+      // :GXL[n]#   Get driver Load summary for axis [n]
+      //            Returns: acceleration scale,minimum load during the last slew,number of samples
+      if (parameter[0] == 'L') {
+        int index = parameter[1] - '1';
+        if (index > 8) { *commandError = CE_PARAM_RANGE; return true; }
+        if (index + 1 != axisNumber) return false; // command wasn't processed
+        char temp[20];
+        sprintF(temp, "%1.3f", load.getAccelScale());
+        sprintf(reply, "%s,%u,%d", temp, (unsigned int)load.getMinimum(), load.getCount());
+        *numericReply = false;
+      } else
     #endif
 
     // :GXU[n]#   Get stepper driver statUs for axis [n]
@@ -92,6 +127,40 @@ bool Axis::command(char *reply, char *command, char *parameter, bool *supressFra
     } else return false;
   } else
 
+  #ifdef LOAD_TELEMETRY_PRESENT
+    // :GXL[n],[i]# Get driver Load sample [i] for axis [n], 0 is the most recent
+    //            Returns: age in ms,StallGuard load,CoolStep current scale,flags
+    if (command[0] == 'G' && command[1] == 'X' && parameter[0] == 'L' && parameter[2] == ',') {
+      int index = parameter[1] - '1';
+      if (index < 0 || index > 8) { *commandError = CE_PARAM_RANGE; return true; }
+      if (index + 1 != axisNumber) return false; // command wasn't processed
+
+      LoadSample sample;
+      if (!load.getSample(atoi(&parameter[3]), &sample)) { *commandError = CE_PARAM_RANGE; return true; }
+      sprintf(reply, "%lu,%u,%u,%u", millis() - sample.time, (unsigned int)sample.load,
+        (unsigned int)sample.currentScale, (unsigned int)sample.flags);
+      *numericReply = false;
+    } else
+  #endif
+
+  #ifdef SERVO_MOTOR_PRESENT
+    // :SXT[n],[r]# Start servo autotune for axis [n] with relay amplitude [r] in % of the control range (1 to 30)
+    //            or :SXT[n],0# to cancel
+    //            Return: 0 on failure
+    //                    1 on success
+    if (command[0] == 'S' && command[1] == 'X' && parameter[0] == 'T' && parameter[2] == ',') {
+      int index = parameter[1] - '1';
+      if (index < 0 || index > 8) { *commandError = CE_PARAM_RANGE; return true; }
+      if (index + 1 != axisNumber) return false; // command wasn't processed
+      if (motor->driverType != SERVO) { *commandError = CE_CMD_UNKNOWN; return true; } // not a servo
+
+      float relayPercent = atof(&parameter[3]);
+      if (relayPercent < 0.0F || relayPercent > 30.0F) { *commandError = CE_PARAM_RANGE; return true; }
+      if (relayPercent == 0.0F) ((ServoMotor*)motor)->autotune.cancel(); else
+      if (!((ServoMotor*)motor)->autotuneStart(relayPercent)) *commandError = CE_0;
+    } else
+  #endif
+
   // :SXA[n]#   Set axis/driver configuration
   if (command[0] == 'S' && command[1] == 'X' && parameter[0] == 'A' && parameter[2] == ',') {
     uint16_t axesToRevert = nv.readUI(NV_AXIS_SETTINGS_REVERT);
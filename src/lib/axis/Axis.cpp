@@ -100,6 +100,7 @@ bool Axis::init(Motor *motor) {
   homeSenseHandle = sense.add(pins->home, pins->axisSense.homeInit, pins->axisSense.homeTrigger);
   minSenseHandle = sense.add(pins->min, pins->axisSense.minMaxInit, pins->axisSense.minTrigger);
   maxSenseHandle = sense.add(pins->max, pins->axisSense.minMaxInit, pins->axisSense.maxTrigger);
+  sense.setLatch(homeSenseHandle, motor->getMotorStepsSource());
   #if LIMIT_SENSE_STRICT != ON
     commonMinMaxSense = pins->min != OFF && pins->min == pins->max;
   #endif
@@ -244,6 +245,7 @@ void Axis::setInstrumentCoordinatePark(double value) {
 // with backlash disabled this moves to the nearest position where the motor doesn't cog
 void Axis::setTargetCoordinatePark(double value) {
   motor->setFrequencySteps(0);
+  commandedFreq = 0.0F;
   motor->setTargetCoordinateParkSteps(lround(unwrapNearest(value)*settings.stepsPerMeasure), settings.subdivisions);
 }
 
@@ -321,6 +323,7 @@ CommandError Axis::autoGoto(float frequency) {
   V(axisPrefix);
   VF("autoGoto start ");
 
+  offsetCancel();
   motor->markOriginCoordinateSteps();
   motor->setSynchronized(false);
   motor->setSlewing(true);
@@ -390,7 +393,15 @@ CommandError Axis::autoSlewHome(unsigned long timeout) {
 
   if (pins->axisSense.homeTrigger != OFF) {
     motor->setSynchronized(true);
-    if (homingStage == HOME_NONE) homingStage = HOME_FAST;
+    if (homingStage == HOME_NONE) {
+      homingStage = HOME_FAST;
+
+      // forget any home sense edges from before homing started
+      unsigned long edgeTimeUs;
+      homeLatched = false;
+      sense.edge(homeSenseHandle, true, &edgeTimeUs, &homeLatchSteps);
+      sense.edge(homeSenseHandle, false, &edgeTimeUs, &homeLatchSteps);
+    }
     if (autoRate == AR_NONE) {
       motor->setSlewing(true);
       V(axisPrefix); VF("autoSlewHome ");
@@ -452,6 +463,59 @@ bool Axis::isSlewing() {
   return autoRate != AR_NONE;  
 }
 
+// adds a position offset in "measures" (radians, microns, etc.) to the target, paid out at the
+// backlash rate while the base rate continues, must be within the offset limit
+CommandError Axis::offset(float value) {
+  if (!enabled) return CE_SLEW_ERR_IN_STANDBY;
+  if (autoRate != AR_NONE) return CE_SLEW_IN_SLEW;
+  if (motionError(DIR_BOTH)) return CE_SLEW_ERR_OUTSIDE_LIMITS;
+
+  long steps = lroundf(value*settings.stepsPerMeasure);
+  if (labs(offsetSteps + steps) > lroundf(offsetLimit*settings.stepsPerMeasure)) return CE_SLEW_ERR_OUTSIDE_LIMITS;
+
+  offsetSteps += steps;
+  return CE_NONE;
+}
+
+// pays out any position offset, returns the frequency needed in "measures" per second
+float Axis::offsetPoll() {
+  if (!offsetting) {
+    if (offsetSteps == 0) return 0.0F;
+
+    // the motor runs unsynchronized toward a target that carries the base rate forward
+    offsetting = true;
+    offsetTotalSteps = 0;
+    offsetStartTimeUs = micros();
+    motor->setSynchronized(false);
+    offsetOriginSteps = motor->getTargetCoordinateSteps();
+  }
+
+  offsetTotalSteps += offsetSteps;
+  offsetSteps = 0;
+
+  float baseSteps = baseFreq*settings.stepsPerMeasure*((micros() - offsetStartTimeUs)/1000000.0F);
+  motor->setTargetCoordinateSteps(offsetOriginSteps + offsetTotalSteps + lroundf(baseSteps));
+
+  // the payout runs toward the target, which isn't always the way the base rate is moving
+  long distanceSteps = motor->getTargetDistanceSteps();
+  if (distanceSteps == 0) {
+    V(axisPrefix); VF("offset of "); V(offsetTotalSteps); VF(" steps took "); V(micros() - offsetStartTimeUs); VLF(" us");
+    offsetCancel();
+    return 0.0F;
+  }
+
+  if (distanceSteps < 0) return -backlashFreq; else return backlashFreq;
+}
+
+// drops any position offset and resumes synchronized movement
+void Axis::offsetCancel() {
+  offsetSteps = 0;
+  if (offsetting) {
+    offsetting = false;
+    motor->setSynchronized(true);
+  }
+}
+
 // monitor movement
 void Axis::poll() {
   // make sure we're ready
@@ -480,8 +544,18 @@ void Axis::poll() {
 
   // stop homing as we pass by the switch or times out
   if (homingStage != HOME_NONE && (autoRate == AR_RATE_BY_TIME_FORWARD || autoRate == AR_RATE_BY_TIME_REVERSE)) {
-    if (autoRate == AR_RATE_BY_TIME_FORWARD && !sense.isOn(homeSenseHandle)) autoSlewStop();
-    if (autoRate == AR_RATE_BY_TIME_REVERSE && sense.isOn(homeSenseHandle)) autoSlewStop();
+    if (sense.isInterruptDriven(homeSenseHandle)) {
+      // the motor position is latched at the edge so the stop can take as long as it likes
+      unsigned long edgeTimeUs;
+      if (sense.edge(homeSenseHandle, autoRate == AR_RATE_BY_TIME_REVERSE, &edgeTimeUs, &homeLatchSteps)) {
+        V(axisPrefix); VF("home sense edge latched at "); V(homeLatchSteps); VLF(" steps");
+        homeLatched = true;
+        autoSlewStop();
+      }
+    } else {
+      if (autoRate == AR_RATE_BY_TIME_FORWARD && !sense.isOn(homeSenseHandle)) autoSlewStop();
+      if (autoRate == AR_RATE_BY_TIME_REVERSE && sense.isOn(homeSenseHandle)) autoSlewStop();
+    }
     if ((long)(millis() - homeTimeoutTime) > 0) {
       V(axisPrefix); VLF("autoSlewHome timed out");
       autoSlewAbort();
@@ -489,6 +563,17 @@ void Axis::poll() {
   }
   Y;
 
+  // driver load telemetry, reduces slew acceleration when the load margin gets too small
+  #ifdef LOAD_TELEMETRY_PRESENT
+    load.poll(autoRate != AR_NONE, getStatus());
+    float accelRateFs = slewAccelRateFs*load.getAccelScale();
+  #else
+    float accelRateFs = slewAccelRateFs;
+  #endif
+
+  // slews take over the target, any offset in progress is dropped
+  if (autoRate != AR_NONE) offsetCancel();
+
   // slewing
   if (autoRate != AR_NONE && !motor->inBacklash) {
 
@@ -515,9 +600,13 @@ void Axis::poll() {
         autoRate = AR_NONE;
         freq = 0.0F;
         motor->setSynchronized(true);
+        if (homingStage != HOME_NONE) {
+          homingStage = HOME_NONE;
+          V(axisPrefix); VLF("autoSlewHome arrived at the latched home sense edge");
+        }
         V(axisPrefix); VLF("slew stopped");
       } else {
-        freq = sqrtf(2.0F*(slewAccelRateFs*FRACTIONAL_SEC)*getOriginOrTargetDistance());
+        freq = sqrtf(2.0F*(accelRateFs*FRACTIONAL_SEC)*getOriginOrTargetDistance());
         if (freq < backlashFreq) freq = backlashFreq;
         if (freq > slewFreq) freq = slewFreq;
         if (motor->getTargetDistanceSteps() < 0) freq = -freq;
@@ -525,11 +614,11 @@ void Axis::poll() {
       }
     } else
     if (autoRate == AR_RATE_BY_TIME_FORWARD) {
-      freq += slewAccelRateFs;
+      freq += accelRateFs;
       if (freq > slewFreq) freq = slewFreq;
     } else
     if (autoRate == AR_RATE_BY_TIME_REVERSE) {
-      freq -= slewAccelRateFs;
+      freq -= accelRateFs;
       if (freq < -slewFreq) freq = -slewFreq;
     } else
     if (autoRate == AR_RATE_BY_TIME_END) {
@@ -539,26 +628,34 @@ void Axis::poll() {
         return;
       }
 
-      if (freq > slewAccelRateFs) freq -= slewAccelRateFs; else if (freq < -slewAccelRateFs) freq += slewAccelRateFs; else freq = 0.0F;
-      if (fabs(freq) <= slewAccelRateFs) {
+      if (freq > accelRateFs) freq -= accelRateFs; else if (freq < -accelRateFs) freq += accelRateFs; else freq = 0.0F;
+      if (fabs(freq) <= accelRateFs) {
         motor->setSlewing(false);
         autoRate = AR_NONE;
         freq = 0.0F;
-        if (homingStage == HOME_FAST) homingStage = HOME_SLOW; else 
-        if (homingStage == HOME_SLOW) {
-          if (!sense.isOn(homeSenseHandle)) homingStage = HOME_FINE; else {
-            slewFreq *= 6.0F;
-            V(axisPrefix); VLF("autoSlewHome approach correction");
-          }
-        } else
-        if (homingStage == HOME_FINE) homingStage = HOME_NONE;
-        if (homingStage != HOME_NONE) {
-          float f = fabs(slewFreq)/6.0F;
-          if (f < 0.0003F) f = 0.0003F;
-          setFrequencySlew(f);
-          autoSlewHome(SLEW_HOME_REFINE_TIME_LIMIT * 1000);
+        if (homingStage != HOME_NONE && homeLatched) {
+          // return to the latched edge in one pass rather than refining at slower rates
+          homeLatched = false;
+          motor->setTargetCoordinateSteps(homeLatchSteps + motor->getIndexPositionSteps());
+          V(axisPrefix); VLF("autoSlewHome returning to the latched home sense edge");
+          if (autoGoto() != CE_NONE) homingStage = HOME_NONE;
         } else {
-          V(axisPrefix); VLF("slew stopped");
+          if (homingStage == HOME_FAST) homingStage = HOME_SLOW; else 
+          if (homingStage == HOME_SLOW) {
+            if (!sense.isOn(homeSenseHandle)) homingStage = HOME_FINE; else {
+              slewFreq *= 6.0F;
+              V(axisPrefix); VLF("autoSlewHome approach correction");
+            }
+          } else
+          if (homingStage == HOME_FINE) homingStage = HOME_NONE;
+          if (homingStage != HOME_NONE) {
+            float f = fabs(slewFreq)/6.0F;
+            if (f < 0.0003F) f = 0.0003F;
+            setFrequencySlew(f);
+            autoSlewHome(SLEW_HOME_REFINE_TIME_LIMIT * 1000);
+          } else {
+            V(axisPrefix); VLF("slew stopped");
+          }
         }
       }
     } else
@@ -573,7 +670,8 @@ void Axis::poll() {
     } else freq = 0.0F;
   } else {
     freq = 0.0F;
-    if (commonMinMaxSensed || motionError(DIR_BOTH) || motorFault()) baseFreq = 0.0F;
+    if (commonMinMaxSensed || motionError(DIR_BOTH) || motorFault()) { baseFreq = 0.0F; offsetCancel(); }
+    if (isOffsetting()) freq = offsetPoll();
   }
   Y;
 
@@ -648,14 +746,10 @@ void Axis::setFrequency(float frequency) {
 
   // apply base frequency as required
   if (enabled) {
-    if (autoRate == AR_NONE) {
-      motor->setFrequencySteps((frequency + baseFreq)*settings.stepsPerMeasure);
-    } else {
-      motor->setFrequencySteps(frequency*settings.stepsPerMeasure);
-    }
-  } else {
-    motor->setFrequencySteps(0.0F);
-  }
+    if (autoRate == AR_NONE) frequency += baseFreq;
+    motor->setFrequencySteps(frequency*settings.stepsPerMeasure);
+  } else frequency = 0.0F;
+  commandedFreq = frequency;
 }
 
 // get frequency in "measures" (degrees, microns, etc.) per second
@@ -663,6 +757,18 @@ float Axis::getFrequency() {
   return motor->getFrequencySteps()/settings.stepsPerMeasure;
 }
 
+// distance needed to come to a stop from the current frequency at the slew acceleration rate
+// in "measures" (radians, microns, etc.)
+float Axis::getStoppingDistance() {
+  #ifdef LOAD_TELEMETRY_PRESENT
+    float accelRate = slewAccelRateFs*load.getAccelScale()*FRACTIONAL_SEC;
+  #else
+    float accelRate = slewAccelRateFs*FRACTIONAL_SEC;
+  #endif
+  if (accelRate <= 0.0F) return 0.0F;
+  return (commandedFreq*commandedFreq)/(2.0F*accelRate);
+}
+
 // gets backlash frequency in "measures" (degrees, microns, etc.) per second
 float Axis::getBacklashFrequency() {
   return backlashFreq;
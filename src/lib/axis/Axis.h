@@ -40,6 +40,7 @@
 #include "motor/stepDir/StepDir.h"
 #include "motor/servo/Servo.h"
 #include "motor/oDrive/ODrive.h"
+#include "motor/LoadTelemetry.h"
 
 // helpers for step/dir and servo parameters
 #define subdivisions param1
@@ -145,6 +146,12 @@ class Axis {
     // get motor position, in steps
     inline long getMotorPositionSteps() { return motor->getMotorPositionSteps(); }
 
+    // get the motor position in steps (not counting backlash) for latching from an ISR
+    inline volatile long *getMotorStepsSource() { return motor->getMotorStepsSource(); }
+
+    // get the steps taken into the backlash, the difference between the two motor positions above
+    inline long getBacklashPositionSteps() { return motor->getBacklashPositionSteps(); }
+
     // get index position, in "measure" units
     double getIndexPosition();
 
@@ -212,6 +219,14 @@ class Axis {
     // get frequency in steps per second
     float getFrequencySteps() { return motor->getFrequencySteps(); }
 
+    // get the commanded frequency in "measures" (degrees, microns, etc.) per second, signed for direction
+    // unlike getFrequency() this isn't the motor's (unsigned, possibly microstep scaled) step rate
+    inline float getFrequencyCommanded() { return commandedFreq; }
+
+    // distance needed to come to a stop from the current frequency at the slew acceleration rate
+    // in "measures" (radians, microns, etc.)
+    float getStoppingDistance();
+
     // get direction
     Direction getDirection() { return motor->getDirection(); }
 
@@ -278,6 +293,16 @@ class Axis {
     // checks if slew is active on this axis
     bool isSlewing();
 
+    // adds a position offset in "measures" (radians, microns, etc.) to the target, paid out at the
+    // backlash rate while the base rate continues, must be within the offset limit
+    CommandError offset(float value);
+
+    // checks if a position offset is being paid out on this axis
+    inline bool isOffsetting() { return offsetting || offsetSteps != 0; }
+
+    // set the largest position offset accepted in "measures" (radians, microns, etc.), 0 disables offsets
+    inline void setOffsetLimit(float value) { offsetLimit = value; }
+
     // returns 1 if departing origin or -1 if approaching target
     inline int getRampDirection() { return motor->getRampDirection(); }
 
@@ -328,6 +353,12 @@ class Axis {
     // distance to origin or target, whichever is closer, in "measures" (degrees, microns, etc.)
     double getOriginOrTargetDistance();
 
+    // pays out any position offset, returns the frequency needed in "measures" per second
+    float offsetPoll();
+
+    // drops any position offset and resumes synchronized movement
+    void offsetCancel();
+
     // returns true if traveling through backlash
     bool inBacklash();
 
@@ -381,9 +412,14 @@ class Axis {
     // timeout for home switch detection
     unsigned long homeTimeoutTime = 0;
 
+    // motor position latched at the home sense edge (interrupt driven sense only)
+    bool homeLatched = false;
+    long homeLatchSteps = 0;
+
     // rates (in measures per second) to control motor movement
     float freq = 0.0F;
     float rampFreq = 0.0F;
+    float commandedFreq = 0.0F;        // last frequency given to the motor, including the base frequency
     float baseFreq = 0.0F;
     float minFreq = 0.0F;
     float slewFreq = 0.0F;
@@ -392,12 +428,24 @@ class Axis {
 
     float targetTolerance = 0.0F;
 
+    // position offset (in steps) waiting to be paid out and the payout in progress
+    long offsetSteps = 0;
+    long offsetTotalSteps = 0;
+    long offsetOriginSteps = 0;
+    unsigned long offsetStartTimeUs = 0;
+    bool offsetting = false;
+    float offsetLimit = 0.0F;
+
     AutoRate autoRate = AR_NONE;       // auto slew mode
     float slewAccelRateFs;             // auto slew rate in measures per second per frac-sec
     float abortAccelRateFs;            // abort slew rate in measures per second per frac-sec
     float slewAccelTime = NAN;         // auto slew acceleration time in seconds
     float abortAccelTime = NAN;        // abort slew acceleration time in seconds
 
+    #ifdef LOAD_TELEMETRY_PRESENT
+      LoadTelemetry load;
+    #endif
+
     HomingStage homingStage = HOME_NONE;
 
     const AxisPins *pins;
@@ -13,4 +13,7 @@ typedef struct DriverStatus {
   bool overTemperature;
   bool standstill;
   bool fault;
+  bool loadValid;        // true if the driver reports StallGuard load
+  uint16_t load;         // StallGuard result, lower values are higher load (0 is stalled)
+  uint8_t currentScale;  // CoolStep actual current scaling (0 to 31)
 } DriverStatus;
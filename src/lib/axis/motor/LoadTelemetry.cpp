@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------
+// axis motor driver load telemetry (StallGuard/CoolStep)
+
+#include "LoadTelemetry.h"
+
+#ifdef LOAD_TELEMETRY_PRESENT
+
+// records driver load while slewing and adjusts the acceleration scale as each slew ends
+void LoadTelemetry::poll(bool slewing, DriverStatus status) {
+  if (slewing && !this->slewing) slewMinimum = UINT16_MAX;
+
+  if (!slewing && this->slewing) {
+    // a slew with little load margin left reduces the acceleration of later slews, one
+    // with plenty of margin lets it recover; it's never changed mid-slew since that would
+    // step the ramp frequency
+    #if LOAD_MARGIN_MIN != OFF
+      if (slewMinimum != UINT16_MAX) {
+        if (slewMinimum < LOAD_MARGIN_MIN) {
+          accelScale *= 0.75F;
+          if (accelScale < LOAD_ACCEL_SCALE_MIN) accelScale = LOAD_ACCEL_SCALE_MIN;
+          VF("MSG: LoadTelemetry, low load margin "); V(slewMinimum); VF(" slew acceleration now "); V(accelScale*100.0F); VLF("%");
+        } else
+        if (slewMinimum > LOAD_MARGIN_MIN*2 && accelScale < 1.0F) {
+          accelScale *= 1.1F;
+          if (accelScale > 1.0F) accelScale = 1.0F;
+        }
+      }
+    #endif
+  }
+  this->slewing = slewing;
+
+  if (!slewing || !status.loadValid) return;
+  if ((long)(millis() - lastSampleTime) < LOAD_TELEMETRY_PERIOD_MS) return;
+  lastSampleTime = millis();
+
+  LoadSample *s = &sample[head];
+  s->time = lastSampleTime;
+  s->load = status.load;
+  s->currentScale = status.currentScale;
+  s->flags = 0;
+  if (status.outputA.openLoad) s->flags |= LOAD_FLAG_OPEN_LOAD_A;
+  if (status.outputB.openLoad) s->flags |= LOAD_FLAG_OPEN_LOAD_B;
+  if (status.outputA.shortToGround || status.outputB.shortToGround) s->flags |= LOAD_FLAG_SHORT;
+  if (status.overTemperatureWarning) s->flags |= LOAD_FLAG_OVER_TEMP_WARN;
+  if (status.overTemperature) s->flags |= LOAD_FLAG_OVER_TEMP;
+
+  head = (head + 1) % LOAD_TELEMETRY_SAMPLES;
+  if (count < LOAD_TELEMETRY_SAMPLES) count++;
+
+  if (status.load < slewMinimum) slewMinimum = status.load;
+}
+
+// gets a sample, index 0 is the most recent
+bool LoadTelemetry::getSample(int index, LoadSample *sample) {
+  if (index < 0 || index >= count) return false;
+  *sample = this->sample[(head + LOAD_TELEMETRY_SAMPLES - 1 - index) % LOAD_TELEMETRY_SAMPLES];
+  return true;
+}
+
+#endif
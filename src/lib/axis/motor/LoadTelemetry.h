@@ -0,0 +1,70 @@
+// -----------------------------------------------------------------------------------
+// axis motor driver load telemetry (StallGuard/CoolStep)
+#pragma once
+
+#include "../../../Common.h"
+
+#if defined(STEP_DIR_TMC_SPI_PRESENT) || defined(STEP_DIR_TMC_UART_PRESENT)
+  #define LOAD_TELEMETRY_PRESENT
+#endif
+
+#ifdef LOAD_TELEMETRY_PRESENT
+
+#include "Drivers.h"
+
+#ifndef LOAD_TELEMETRY_SAMPLES
+  #define LOAD_TELEMETRY_SAMPLES   16    // samples kept for each axis
+#endif
+#ifndef LOAD_TELEMETRY_PERIOD_MS
+  #define LOAD_TELEMETRY_PERIOD_MS 200   // time between samples while slewing
+#endif
+#ifndef LOAD_MARGIN_MIN
+  #define LOAD_MARGIN_MIN          OFF   // StallGuard result below which slew acceleration is reduced, OFF disables
+#endif
+#ifndef LOAD_ACCEL_SCALE_MIN
+  #define LOAD_ACCEL_SCALE_MIN     0.5F  // lowest fraction of the slew acceleration that load reduction goes to
+#endif
+
+// sample flags
+#define LOAD_FLAG_OPEN_LOAD_A     1
+#define LOAD_FLAG_OPEN_LOAD_B     2
+#define LOAD_FLAG_SHORT           4
+#define LOAD_FLAG_OVER_TEMP_WARN  8
+#define LOAD_FLAG_OVER_TEMP       16
+
+typedef struct LoadSample {
+  unsigned long time;
+  uint16_t load;
+  uint8_t currentScale;
+  uint8_t flags;
+} LoadSample;
+
+class LoadTelemetry {
+  public:
+    // records driver load while slewing and adjusts the acceleration scale as each slew ends
+    void poll(bool slewing, DriverStatus status);
+
+    // gets a sample, index 0 is the most recent
+    // returns false if no such sample exists
+    bool getSample(int index, LoadSample *sample);
+
+    // number of samples held
+    inline int getCount() { return count; }
+
+    // lowest load margin (StallGuard result) seen during the last or current slew
+    inline uint16_t getMinimum() { return slewMinimum; }
+
+    // fraction of the slew acceleration rate to use, only changes between slews
+    inline float getAccelScale() { return accelScale; }
+
+  private:
+    LoadSample sample[LOAD_TELEMETRY_SAMPLES];
+    uint8_t head = 0;
+    uint8_t count = 0;
+    bool slewing = false;
+    uint16_t slewMinimum = UINT16_MAX;
+    unsigned long lastSampleTime = 0;
+    float accelScale = 1.0F;
+};
+
+#endif
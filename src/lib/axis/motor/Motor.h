@@ -51,6 +51,12 @@ class Motor {
     // get index position in steps
     inline long getIndexPositionSteps() { return indexSteps; }
 
+    // get the motor position in steps (not counting backlash) for latching from an ISR
+    inline volatile long *getMotorStepsSource() { return &motorSteps; }
+
+    // get the steps taken into the backlash, the difference between the two motor positions above
+    inline long getBacklashPositionSteps() { return backlashSteps; }
+
     // get instrument coordinate, in steps
     virtual long getInstrumentCoordinateSteps();
 
@@ -0,0 +1,28 @@
+// -----------------------------------------------------------------------------------
+// TMC driver register shadow and shared status polling schedule
+
+#include "TmcShadow.h"
+
+#ifdef MOTOR_PRESENT
+
+unsigned long tmcLastStatusTime = 0;
+
+// returns true if the value differs from the one last written and records it
+bool TmcShadow::changed(TmcShadowRegister reg, uint32_t value) {
+  if ((valid & (1 << reg)) && this->value[reg] == value) return false;
+  this->value[reg] = value;
+  valid |= (1 << reg);
+  return true;
+}
+
+// true if this driver's status should be read now
+bool TmcShadow::statusDue() {
+  unsigned long now = millis();
+  if ((long)(now - lastStatusTime) <= TMC_STATUS_PERIOD_MS) return false;
+  if ((long)(now - tmcLastStatusTime) < TMC_STATUS_SPACING_MS) return false;
+  lastStatusTime = now;
+  tmcLastStatusTime = now;
+  return true;
+}
+
+#endif
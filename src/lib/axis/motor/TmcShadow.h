@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------------
+// TMC driver register shadow and shared status polling schedule
+#pragma once
+
+#include "../../../Common.h"
+
+#ifdef MOTOR_PRESENT
+
+#ifndef TMC_STATUS_PERIOD_MS
+  #define TMC_STATUS_PERIOD_MS  200 // time between status reads for each driver
+#endif
+#ifndef TMC_STATUS_SPACING_MS
+  #define TMC_STATUS_SPACING_MS 20  // minimum time between status reads of any two drivers
+#endif
+
+// the driver settings that are tracked, some are a whole register others a field within one
+enum TmcShadowRegister: uint8_t {TSR_MICROSTEPS, TSR_DECAY, TSR_CURRENT, TSR_VELOCITY, TSR_DIRECTION, TSR_COUNT};
+
+// remembers what was last written to the driver so repeated mode switches and velocity updates
+// only generate bus traffic when something actually changes
+class TmcShadow {
+  public:
+    // returns true if the value differs from the one last written and records it
+    bool changed(TmcShadowRegister reg, uint32_t value);
+
+    // forget a value written behind the shadow's back so the next write goes through
+    inline void invalidate(TmcShadowRegister reg) { valid &= ~(1 << reg); }
+
+    // forget all values, drivers do this when enabled since a driver that lost motor power while
+    // disabled comes back with its registers reset and every setting must be written again
+    inline void invalidate() { valid = 0; }
+
+    // true if this driver's status should be read now, status reads of all drivers are spaced
+    // at least TMC_STATUS_SPACING_MS apart so they don't bunch up in a single poll
+    bool statusDue();
+
+  private:
+    uint32_t value[TSR_COUNT];
+    uint8_t valid = 0;
+    unsigned long lastStatusTime = 0;
+};
+
+#endif
@@ -20,6 +20,103 @@ IRAM_ATTR void moveODriveMotorAxis2() { odriveMotorInstance[1]->move(); }
   ODriveTeensyCAN *_oDriveDriver;
 #endif
 
+#if ODRIVE_STREAMING == ON
+  // setpoints for both ODrive axes, sent together once each has been updated
+  typedef struct ODriveSetpoint {
+    float position;                     // in turns
+    float velocity;                     // in turns per second
+    float torque;                       // in Nm
+    bool  updated;
+  } ODriveSetpoint;
+
+  // encoder estimates read back from the ODrive
+  typedef struct ODriveEstimate {
+    float position;                     // in turns
+    float velocity;                     // in turns per second
+    unsigned long time;                 // in milliseconds
+    bool  valid;
+  } ODriveEstimate;
+
+  ODriveSetpoint odriveSetpoint[2] = { {0, 0, 0, false}, {0, 0, 0, false} };
+  ODriveEstimate odriveEstimate[2] = { {0, 0, 0, false}, {0, 0, 0, false} };
+
+  #if ODRIVE_COMM_MODE == OD_UART
+    // replies to the "f" feedback requests arrive in the order they were sent
+    uint8_t odriveReplyAxis[2];
+    uint8_t odriveRepliesPending = 0;
+    char odriveReply[32];
+    uint8_t odriveReplyPos = 0;
+
+    // collect any complete feedback replies without waiting
+    void odriveReadReplies() {
+      while (ODRIVE_SERIAL.available()) {
+        char c = ODRIVE_SERIAL.read();
+        if (c == '\r') continue;
+        if (c != '\n') {
+          if (odriveReplyPos < sizeof(odriveReply) - 1) odriveReply[odriveReplyPos++] = c;
+          continue;
+        }
+        odriveReply[odriveReplyPos] = 0;
+        odriveReplyPos = 0;
+        if (odriveRepliesPending == 0) continue;
+
+        uint8_t axis = odriveReplyAxis[0];
+        odriveReplyAxis[0] = odriveReplyAxis[1];
+        odriveRepliesPending--;
+
+        char *conv_end;
+        float position = strtod(odriveReply, &conv_end);
+        if (conv_end == odriveReply) continue;
+        char *velocityStr = conv_end;
+        float velocity = strtod(velocityStr, &conv_end);
+        if (conv_end == velocityStr) continue;
+
+        odriveEstimate[axis].position = position;
+        odriveEstimate[axis].velocity = velocity;
+        odriveEstimate[axis].time = millis();
+        odriveEstimate[axis].valid = true;
+      }
+    }
+  #endif
+
+  // sends the setpoints for all axes that have one and requests their encoder estimates, in a single write
+  void odriveSendSetpoints() {
+    #if ODRIVE_COMM_MODE == OD_UART
+      char frame[160] = "";
+      char temp[24];
+
+      // any replies still outstanding are stale, start over
+      odriveRepliesPending = 0;
+      odriveReplyPos = 0;
+      while (ODRIVE_SERIAL.available()) ODRIVE_SERIAL.read();
+
+      for (uint8_t axis = 0; axis < 2; axis++) {
+        if (!odriveSetpoint[axis].updated) continue;
+        strcat(frame, "p 0 ");
+        frame[strlen(frame) - 2] = '0' + axis;
+        sprintF(temp, "%1.8f ", odriveSetpoint[axis].position); strcat(frame, temp);
+        sprintF(temp, "%1.6f ", odriveSetpoint[axis].velocity); strcat(frame, temp);
+        sprintF(temp, "%1.4f\n", odriveSetpoint[axis].torque); strcat(frame, temp);
+      }
+      for (uint8_t axis = 0; axis < 2; axis++) {
+        if (!odriveSetpoint[axis].updated) continue;
+        strcat(frame, "f 0\n");
+        frame[strlen(frame) - 2] = '0' + axis;
+        odriveReplyAxis[odriveRepliesPending++] = axis;
+      }
+      ODRIVE_SERIAL.write((const uint8_t*)frame, strlen(frame));
+    #elif ODRIVE_COMM_MODE == OD_CAN
+      for (uint8_t axis = 0; axis < 2; axis++) {
+        if (!odriveSetpoint[axis].updated) continue;
+        _oDriveDriver->SetPosition(axis, odriveSetpoint[axis].position, odriveSetpoint[axis].velocity, odriveSetpoint[axis].torque);
+      }
+    #endif
+
+    odriveSetpoint[0].updated = false;
+    odriveSetpoint[1].updated = false;
+  }
+#endif
+
 // constructor
 ODriveMotor::ODriveMotor(uint8_t axisNumber, const ODriveDriverSettings *Settings, bool useFastHardwareTimers) {
   if (axisNumber < 1 || axisNumber > 2) return;
@@ -72,6 +169,12 @@ bool ODriveMotor::init() {
 
   enable(false);
 
+  #if ODRIVE_STREAMING == ON
+    // the setpoints are computed and streamed from poll(), no step timer is needed
+    V(axisPrefix); VF("streaming setpoints every "); V(ODRIVE_STREAM_MS); VLF("ms");
+    return true;
+  #endif
+
   // start the motor timer
   V(axisPrefix);
   VF("start task to move motor... ");
@@ -149,14 +252,23 @@ void ODriveMotor::enable(bool state) {
 }
 
 void ODriveMotor::setInstrumentCoordinateSteps(long value) {
+  // the index is set against the same position getInstrumentCoordinateSteps() reads back from
+  long steps;
+  #if ODRIVE_STREAMING == ON
+    bool encoder = getEncoderSteps(&steps);
+  #else
+    bool encoder = false;
+  #endif
+
+  noInterrupts();
+  if (!encoder) steps = motorSteps;
+  long index = value - steps;
   #if ODRIVE_ABSOLUTE == ON && ODRIVE_SYNC_LIMIT != OFF
-    noInterrupts();
-    long index = value - motorSteps;
-    interrupts();
     float indexDeg = index/stepsPerMeasure;
     if (indexDeg >= -degToRadF(ODRIVE_SYNC_LIMIT/3600.0F) && indexDeg <= degToRadF(ODRIVE_SYNC_LIMIT/3600.0F))
   #endif
-  Motor::setInstrumentCoordinateSteps(value);
+  indexSteps = index;
+  interrupts();
 }
 
 // get the associated driver status
@@ -206,6 +318,17 @@ void ODriveMotor::setFrequencySteps(float frequency) {
   if (inBacklash)
     frequency = backlashFrequency;
 
+  #if ODRIVE_STREAMING == ON
+    // poll() advances the position at this rate
+    currentFrequency = frequency;
+    noInterrupts();
+    streamVelocity = frequency*dir;
+    step = dir;
+    absStep = 1;
+    interrupts();
+    return;
+  #endif
+
   if (frequency != currentFrequency) {
     lastFrequency = frequency;
 
@@ -242,6 +365,9 @@ void ODriveMotor::setFrequencySteps(float frequency) {
 }
 
 float ODriveMotor::getFrequencySteps() {
+  #if ODRIVE_STREAMING == ON
+    return currentFrequency;
+  #endif
   if (lastPeriod == 0) return 0;
   return (16000000.0F / lastPeriod) * absStep;
 }
@@ -253,6 +379,51 @@ void ODriveMotor::setSlewing(bool state) {
 
 // updates PID and sets odrive position
 void ODriveMotor::poll() {
+  #if ODRIVE_STREAMING == ON
+    #if ODRIVE_COMM_MODE == OD_UART
+      odriveReadReplies();
+    #endif
+
+    unsigned long now = micros();
+    float dt = (now - lastStreamTime)/1000000.0F;
+    if (dt < ODRIVE_STREAM_MS/1000.0F) return;
+    lastStreamTime = now;
+    if (dt > 1.0F) dt = 0.0F;
+
+    // advance the motor position at the requested rate
+    noInterrupts();
+    float velocity = streamVelocity;
+    interrupts();
+    streamRemainder += fabs(velocity)*dt;
+    long steps = (long)streamRemainder;
+    streamRemainder -= steps;
+    if (steps > 0) advance(steps);
+
+    noInterrupts();
+    #if ODRIVE_SLEW_DIRECT == ON
+      long target = targetSteps + backlashSteps;
+    #else
+      long target = motorSteps + backlashSteps;
+    #endif
+    bool backlash = inBacklash;
+    interrupts();
+
+    // the axis isn't moving while taking up backlash, it's the motor position that changes
+    float stepsPerTurn = TWO_PI*stepsPerMeasure;
+    uint8_t axis = axisNumber - 1;
+    float velocityTurns = velocity/stepsPerTurn;
+    float acceleration = dt > 0.0F ? (velocityTurns - odriveSetpoint[axis].velocity)/dt : 0.0F;
+    odriveSetpoint[axis].position = target/stepsPerTurn;
+    odriveSetpoint[axis].velocity = velocityTurns;
+    odriveSetpoint[axis].torque = backlash ? 0.0F : acceleration*ODRIVE_TORQUE_FF;
+    odriveSetpoint[axis].updated = true;
+
+    // send once every axis present has a new setpoint
+    if ((odriveMotorInstance[0] == NULL || odriveSetpoint[0].updated) &&
+        (odriveMotorInstance[1] == NULL || odriveSetpoint[1].updated)) odriveSendSetpoints();
+    return;
+  #endif
+
   if ((long)(millis() - lastSetPositionTime) < ODRIVE_UPDATE_MS) return;
   lastSetPositionTime = millis();
 
@@ -270,6 +441,55 @@ void ODriveMotor::poll() {
   #endif
 }
 
+#if ODRIVE_STREAMING == ON
+// get instrument coordinate, in steps, from the ODrive encoder estimate when it's current
+long ODriveMotor::getInstrumentCoordinateSteps() {
+  long steps;
+  if (!getEncoderSteps(&steps)) return Motor::getInstrumentCoordinateSteps();
+  noInterrupts();
+  steps += indexSteps;
+  interrupts();
+  return steps;
+}
+
+// get the ODrive encoder estimate in motor steps, returns false if the estimate isn't current
+bool ODriveMotor::getEncoderSteps(long *steps) {
+  ODriveEstimate *estimate = &odriveEstimate[axisNumber - 1];
+  unsigned long age = millis() - estimate->time;
+  if (!estimate->valid || (long)age > ODRIVE_STREAM_MS*4) return false;
+
+  // the ODrive is commanded to motorSteps + backlashSteps (in turns), so its estimate brought
+  // forward to now less the backlash is in motorSteps
+  float turns = estimate->position + estimate->velocity*(age/1000.0F);
+  long encoderSteps = lroundf(turns*TWO_PI*stepsPerMeasure);
+  noInterrupts();
+  *steps = encoderSteps - backlashSteps;
+  interrupts();
+  return true;
+}
+
+// moves coord toward target by this many steps, the equivalent of that many calls to move()
+void ODriveMotor::advance(long steps) {
+  noInterrupts();
+  if (sync && !inBacklash) targetSteps += step*steps;
+
+  if (motorSteps > targetSteps) {
+    long n = min(steps, (long)backlashSteps);
+    if (n > 0) { backlashSteps -= n; steps -= n; }
+    inBacklash = backlashSteps > 0;
+    if (!inBacklash) motorSteps -= min(steps, (long)(motorSteps - targetSteps));
+  } else
+
+  if (motorSteps < targetSteps || inBacklash) {
+    long n = min(steps, (long)backlashAmountSteps - (long)backlashSteps);
+    if (n > 0) { backlashSteps += n; steps -= n; }
+    inBacklash = backlashSteps < backlashAmountSteps;
+    if (!inBacklash) motorSteps += min(steps, (long)(targetSteps - motorSteps));
+  }
+  interrupts();
+}
+#endif
+
 // sets dir as required and moves coord toward target at setFrequencySteps() rate
 IRAM_ATTR void ODriveMotor::move() {
   if (sync && !inBacklash) targetSteps += step;
@@ -32,6 +32,20 @@
   #define ODRIVE_UPDATE_MS   3000
 #endif
 
+// odrive streaming ON sends position, velocity and torque feedforward setpoints for both axes together
+// every ODRIVE_STREAM_MS (no step timer) and reads back the encoder estimates (OD_UART only)
+#ifndef ODRIVE_STREAMING
+  #define ODRIVE_STREAMING   OFF
+#endif
+#ifndef ODRIVE_STREAM_MS
+  #define ODRIVE_STREAM_MS   10
+#endif
+
+// odrive torque feedforward in Nm per turn/s^2 of commanded acceleration (streaming only)
+#ifndef ODRIVE_TORQUE_FF
+  #define ODRIVE_TORQUE_FF   0.0F
+#endif
+
 // odrive direct slewing ON or OFF (ODrive handles acceleration)
 #ifndef ODRIVE_SLEW_DIRECT
   #define ODRIVE_SLEW_DIRECT OFF
@@ -115,7 +129,23 @@ class ODriveMotor : public Motor {
     // sets dir as required and moves coord toward target at setFrequencySteps() rate
     void move();
 
+    #if ODRIVE_STREAMING == ON
+      // get instrument coordinate, in steps, from the ODrive encoder estimate when it's current
+      long getInstrumentCoordinateSteps();
+    #endif
+
   private:
+    #if ODRIVE_STREAMING == ON
+      // moves coord toward target by this many steps, the equivalent of that many calls to move()
+      void advance(long steps);
+
+      // get the ODrive encoder estimate in motor steps, returns false if the estimate isn't current
+      bool getEncoderSteps(long *steps);
+
+      float streamVelocity = 0.0F;        // requested frequency with direction (+/-), in steps per second
+      float streamRemainder = 0.0F;       // fractional steps not yet applied
+      unsigned long lastStreamTime = 0;   // time of the last setpoint (in microseconds)
+    #endif
 
 //  float o_position0 = 0;
 //  float o_position1 = 0;
@@ -42,6 +42,8 @@ ServoMotor::ServoMotor(uint8_t axisNumber, ServoDriver *Driver, Encoder *encoder
   this->encoderReverse = encoderReverse;
   this->encoderReverseDefault = encoderReverse;
 
+  encoderFilterInit();
+
   feedback->getDefaultParameters(&default_param1, &default_param2, &default_param3, &default_param4, &default_param5, &default_param6);
 
   // attach the function pointers to the callbacks
@@ -68,6 +70,9 @@ bool ServoMotor::init() {
   driver->init();
   enable(false);
 
+  // encoders that read in the background can start now
+  encoder->start();
+
   // start the motion timer
   V(axisPrefix);
   VF("start task to track motion... ");
@@ -95,6 +100,7 @@ bool ServoMotor::init() {
 // set driver reverse state
 void ServoMotor::setReverse(int8_t state) {
   feedback->setControlDirection(state);
+  controlDirection = (state == ON) ? -1 : 1;
   if (state == ON) encoderReverse = encoderReverseDefault; else encoderReverse = !encoderReverseDefault; 
 }
 
@@ -125,6 +131,7 @@ void ServoMotor::resetPositionSteps(long value) {
   Motor::resetPositionSteps(value);
   if (syncThreshold == OFF) {
     encoder->write(value);
+    observer.reset(value);
   } else {
     V(axisPrefix);
     VL("absolute encoder ignored reset position");
@@ -172,6 +179,9 @@ void ServoMotor::setFrequencySteps(float frequency) {
   int dir = 0;
   if (frequency > 0.0F) dir = 1; else if (frequency < 0.0F) { frequency = -frequency; dir = -1; }
 
+  // remember the requested rate/direction for feedforward
+  commandedVelocity = frequency*dir;
+
   // if in backlash override the frequency
   if (inBacklash) frequency = backlashFrequency;
 
@@ -249,16 +259,53 @@ void ServoMotor::poll() {
   motorCounts = motorSteps;
   interrupts();
 
-  encoderCounts = encoderApplyFilter(encoderCounts - motorCounts) + motorCounts;
+  encoderCounts = encoderApplyFilter(encoderCounts);
+  control->measuredVelocity = observer.getVelocity();
+
+  // for encoders that record edge times, use the position between counts and the edge rate
+  float encoderFraction = 0.0F;
+  if (!filterEnabled) {
+    float edgeVelocity;
+    if (encoder->readInterpolated(micros(), &encoderFraction, &edgeVelocity)) {
+      if (encoderReverse) { encoderFraction = -encoderFraction; edgeVelocity = -edgeVelocity; }
+      control->measuredVelocity = edgeVelocity;
+    }
+  }
+
+  // commanded motion for feedforward, while taking up backlash the axis (and encoder) shouldn't be moving
+  unsigned long now = micros();
+  float dt = (now - lastPollTime)/1000000.0F;
+  lastPollTime = now;
+  float commandedCountsPerSecond = inBacklash ? 0.0F : commandedVelocity;
+  if (dt > 0.0F && dt < 1.0F) {
+    control->acceleration += ((commandedCountsPerSecond - control->velocity)/dt - control->acceleration)*0.1F;
+  } else control->acceleration = 0.0F;
+  control->velocity = commandedCountsPerSecond;
+  control->inBacklash = inBacklash;
 
   control->set = motorCounts;
-  control->in = encoderCounts;
-  if (enabled) feedback->poll();
+  control->in = encoderCounts + encoderFraction;
+  if (autotune.isRunning() && enabled) {
+    autotune.poll(control);
+    autotuneWasRunning = true;
+  } else {
+    if (autotuneWasRunning) {
+      // the feedback state is stale after autotuning so start it over, the result (done or failed)
+      // is kept unless the tuner was stopped early by the motor being disabled
+      if (autotune.isRunning()) autotune.cancel();
+      feedback->reset();
+      control->set = motorCounts;
+      control->in = encoderCounts + encoderFraction;
+      autotuneWasRunning = false;
+    }
+    if (enabled) feedback->poll();
+  }
 
   float velocity = velocityEstimate + control->out;
   if (!enabled) velocity = 0.0F;
 
   delta = motorCounts - encoderCounts;
+  trackingErrorSquared += ((float)delta*delta - trackingErrorSquared)*0.01F;
   velocityPercent = (driver->setMotorVelocity(velocity)/driver->getMotorControlRange()) * 100.0F;
   if (driver->getMotorDirection() == DIR_FORWARD) control->directionHint = 1; else control->directionHint = -1;
 
@@ -279,8 +326,11 @@ void ServoMotor::poll() {
   if (millis() - lastCheckTime > 2000) {
 
     #ifndef SERVO_SAFETY_DISABLE
+      // distance moved over the check period from the observer velocity, smooth even for coarse encoders
+      float distanceMoved = fabs(observer.getVelocity())*((millis() - lastCheckTime)/1000.0F);
+
       // if above 33% power and we're not moving something is seriously wrong, so shut it down
-      if (labs(encoderCounts - lastEncoderCounts) < 10 && abs(velocityPercent) >= 33) {
+      if (distanceMoved < 10 && abs(velocityPercent) >= 33) {
         D(axisPrefix);
         D("stall detected!"); D(" control->in = "); D(control->in); D(", control->set = "); D(control->set);
         D(", control->out = "); D(control->out); D(", velocity % = "); DL(velocityPercent);
@@ -288,12 +338,12 @@ void ServoMotor::poll() {
       }
 
       // if above 90% power and we're moving away from the target something is seriously wrong, so shut it down
-      if (labs(encoderCounts - lastEncoderCounts) > lastTargetDistance && abs(velocityPercent) >= 90) {
+      if (distanceMoved > lastTargetDistance && abs(velocityPercent) >= 90) {
         D(axisPrefix);
         DL("runaway detected, > 90% power while moving away from the target!");
         enable(false);
       }
-      lastTargetDistance = labs(encoderCounts - lastEncoderCounts);
+      lastTargetDistance = distanceMoved;
 
       // if we were below -33% and above 33% power in a one second period something is seriously wrong, so shut it down
       if (wasBelow33 && wasAbove33) {
@@ -337,6 +387,18 @@ void ServoMotor::poll() {
   UNUSED(encoderCountsOrig);
 }
 
+// start relay feedback autotune, relay amplitude is in % of the motor control range
+bool ServoMotor::autotuneStart(float relayPercent) {
+  if (!enabled) return false;
+
+  // the relay must stay below 33% power or the oscillation would trip the safety checks
+  if (relayPercent < 1.0F) relayPercent = 1.0F;
+  if (relayPercent > 30.0F) relayPercent = 30.0F;
+
+  autotune.start(axisNumber, driver->getMotorControlRange()*relayPercent/100.0F, SERVO_AUTOTUNE_HYSTERESIS, controlDirection);
+  return true;
+}
+
 // sets dir as required and moves coord toward target at setFrequencySteps() rate
 IRAM_ATTR void ServoMotor::move() {
 
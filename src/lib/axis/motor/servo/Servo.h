@@ -19,11 +19,18 @@
 #include "tmc5160/Tmc5160.h"
 
 #include "feedback/Pid/Pid.h"
+#include "feedback/Cascade/Cascade.h"
+#include "autotune/Autotune.h"
+#include "filter/Observer.h"
 
 #ifndef SERVO_SLEW_DIRECT
   #define SERVO_SLEW_DIRECT OFF
 #endif
 
+#ifndef SERVO_AUTOTUNE_HYSTERESIS
+  #define SERVO_AUTOTUNE_HYSTERESIS 2 // in encoder counts
+#endif
+
 #ifndef SERVO_SLEWING_TO_TRACKING_DELAY
   #define SERVO_SLEWING_TO_TRACKING_DELAY 3000 // in milliseconds
 #endif
@@ -84,6 +91,13 @@ class ServoMotor : public Motor {
     // updates PID and sets servo motor power/direction
     void poll();
 
+    // start relay feedback autotune, relay amplitude is in % of the motor control range (1 to 30%)
+    // returns false if the motor isn't enabled
+    bool autotuneStart(float relayPercent);
+
+    // RMS of the difference between motor and encoder position, in counts
+    inline float getTrackingErrorRms() { return sqrtf(trackingErrorSquared); }
+
     // sets dir as required and moves coord toward target at setFrequencySteps() rate
     void move();
     
@@ -101,12 +115,22 @@ class ServoMotor : public Motor {
     float velocityPercent = 0.0F;
     long delta = 0;
 
+    // relay feedback autotune, runs in place of the feedback when started
+    Autotune autotune;
+
   private:
     float velocityEstimate = 0.0F;
     float velocityOverride = 0.0F;
 
+    // configure the encoder observer for this axis
+    void encoderFilterInit();
+
+    // updates the observer with the latest encoder count, returns the filtered count if enabled
     long encoderApplyFilter(long encoderCounts);
 
+    EncoderObserver observer;           // encoder position/velocity estimate
+    bool filterEnabled = false;         // use the estimated rather than raw encoder position
+
     uint8_t servoMonitorHandle = 0;
     uint8_t taskHandle = 0;
     float maxFrequency = HAL_FRACTIONAL_SEC; // fastest timer rate
@@ -117,6 +141,11 @@ class ServoMotor : public Motor {
 
     float currentFrequency = 0.0F;      // last frequency set 
     float lastFrequency = 0.0F;         // last frequency requested
+    float trackingErrorSquared = 0.0F;  // filtered square of delta
+    int8_t controlDirection = 1;        // feedback control direction (for autotune)
+    bool autotuneWasRunning = false;
+    float commandedVelocity = 0.0F;     // last frequency requested with direction (+/-)
+    unsigned long lastPollTime = 0;     // time of the last poll in microseconds (for acceleration feedforward)
     unsigned long lastPeriod = 0;       // last timer period (in sub-micros)
     long syncThreshold = OFF;           // sync threshold in counts (for absolute encoders) or OFF
 
@@ -141,7 +170,7 @@ class ServoMotor : public Motor {
     bool encoderReverseDefault = false;
     bool wasAbove33 = false;
     bool wasBelow33 = false;
-    long lastTargetDistance = 0;
+    float lastTargetDistance = 0.0F;
 };
 
 #endif
\ No newline at end of file
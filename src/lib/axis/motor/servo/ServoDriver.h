@@ -97,7 +97,6 @@ class ServoDriver {
     #if DEBUG != OFF
       DriverStatus lastStatus = {false, {false, false}, {false, false}, false, false, false, false};
     #endif
-    unsigned long timeLastStatusUpdate = 0;
 
     int16_t model = OFF;
     int16_t statusMode = OFF;
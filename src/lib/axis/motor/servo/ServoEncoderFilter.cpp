@@ -33,91 +33,245 @@
   #define AXIS9_SERVO_FLTR OFF
 #endif
 
-#if AXIS1_SERVO_FLTR == KALMAN || AXIS2_SERVO_FLTR == KALMAN || AXIS3_SERVO_FLTR == KALMAN || \
-    AXIS4_SERVO_FLTR == KALMAN || AXIS5_SERVO_FLTR == KALMAN || AXIS6_SERVO_FLTR == KALMAN || \
-    AXIS7_SERVO_FLTR == KALMAN || AXIS8_SERVO_FLTR == KALMAN || AXIS9_SERVO_FLTR == KALMAN
-  #include <SimpleKalmanFilter.h> // https://github.com/denyssene/SimpleKalmanFilter
-#endif
+// KALMAN takes the measurement variance (_MEAS_VAR, in counts^2) and white noise acceleration variance
+// (_ACCEL_VAR, in counts^2/s^4), when these aren't given they are converted from the earlier settings:
+// the measurement uncertainty (_MEAS_U, in counts) squared and the per-sample process variance
+// (_VARIANCE, in counts^2) spread over the nominal servo sample period (1/FRACTIONAL_SEC seconds)
+#define SERVO_FLTR_MEAS_VAR(u) ((u)*(u))
+#define SERVO_FLTR_ACCEL_VAR(v) (4.0F*(v)*FRACTIONAL_SEC*FRACTIONAL_SEC*FRACTIONAL_SEC*FRACTIONAL_SEC)
 
 #if AXIS1_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis1EncoderKalmanFilter(AXIS1_SERVO_FLTR_MEAS_U, AXIS1_SERVO_FLTR_MEAS_U, AXIS1_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS1_SERVO_FLTR_MEAS_VAR
+    #define AXIS1_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS1_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS1_SERVO_FLTR_ACCEL_VAR
+    #define AXIS1_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS1_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS1_SERVO_FLTR_PARAM1 AXIS1_SERVO_FLTR_MEAS_VAR
+  #define AXIS1_SERVO_FLTR_PARAM2 AXIS1_SERVO_FLTR_ACCEL_VAR
+#elif AXIS1_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS1_SERVO_FLTR_ALPHA
+    #define AXIS1_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS1_SERVO_FLTR_BETA
+    #define AXIS1_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS1_SERVO_FLTR_PARAM1 AXIS1_SERVO_FLTR_ALPHA
+  #define AXIS1_SERVO_FLTR_PARAM2 AXIS1_SERVO_FLTR_BETA
+#else
+  #define AXIS1_SERVO_FLTR_PARAM1 0
+  #define AXIS1_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS2_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis2EncoderKalmanFilter(AXIS2_SERVO_FLTR_MEAS_U, AXIS2_SERVO_FLTR_MEAS_U, AXIS2_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS2_SERVO_FLTR_MEAS_VAR
+    #define AXIS2_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS2_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS2_SERVO_FLTR_ACCEL_VAR
+    #define AXIS2_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS2_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS2_SERVO_FLTR_PARAM1 AXIS2_SERVO_FLTR_MEAS_VAR
+  #define AXIS2_SERVO_FLTR_PARAM2 AXIS2_SERVO_FLTR_ACCEL_VAR
+#elif AXIS2_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS2_SERVO_FLTR_ALPHA
+    #define AXIS2_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS2_SERVO_FLTR_BETA
+    #define AXIS2_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS2_SERVO_FLTR_PARAM1 AXIS2_SERVO_FLTR_ALPHA
+  #define AXIS2_SERVO_FLTR_PARAM2 AXIS2_SERVO_FLTR_BETA
+#else
+  #define AXIS2_SERVO_FLTR_PARAM1 0
+  #define AXIS2_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS3_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis3EncoderKalmanFilter(AXIS3_SERVO_FLTR_MEAS_U, AXIS3_SERVO_FLTR_MEAS_U, AXIS3_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS3_SERVO_FLTR_MEAS_VAR
+    #define AXIS3_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS3_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS3_SERVO_FLTR_ACCEL_VAR
+    #define AXIS3_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS3_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS3_SERVO_FLTR_PARAM1 AXIS3_SERVO_FLTR_MEAS_VAR
+  #define AXIS3_SERVO_FLTR_PARAM2 AXIS3_SERVO_FLTR_ACCEL_VAR
+#elif AXIS3_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS3_SERVO_FLTR_ALPHA
+    #define AXIS3_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS3_SERVO_FLTR_BETA
+    #define AXIS3_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS3_SERVO_FLTR_PARAM1 AXIS3_SERVO_FLTR_ALPHA
+  #define AXIS3_SERVO_FLTR_PARAM2 AXIS3_SERVO_FLTR_BETA
+#else
+  #define AXIS3_SERVO_FLTR_PARAM1 0
+  #define AXIS3_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS4_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis4EncoderKalmanFilter(AXIS4_SERVO_FLTR_MEAS_U, AXIS4_SERVO_FLTR_MEAS_U, AXIS4_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS4_SERVO_FLTR_MEAS_VAR
+    #define AXIS4_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS4_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS4_SERVO_FLTR_ACCEL_VAR
+    #define AXIS4_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS4_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS4_SERVO_FLTR_PARAM1 AXIS4_SERVO_FLTR_MEAS_VAR
+  #define AXIS4_SERVO_FLTR_PARAM2 AXIS4_SERVO_FLTR_ACCEL_VAR
+#elif AXIS4_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS4_SERVO_FLTR_ALPHA
+    #define AXIS4_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS4_SERVO_FLTR_BETA
+    #define AXIS4_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS4_SERVO_FLTR_PARAM1 AXIS4_SERVO_FLTR_ALPHA
+  #define AXIS4_SERVO_FLTR_PARAM2 AXIS4_SERVO_FLTR_BETA
+#else
+  #define AXIS4_SERVO_FLTR_PARAM1 0
+  #define AXIS4_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS5_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis5EncoderKalmanFilter(AXIS5_SERVO_FLTR_MEAS_U, AXIS5_SERVO_FLTR_MEAS_U, AXIS5_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS5_SERVO_FLTR_MEAS_VAR
+    #define AXIS5_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS5_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS5_SERVO_FLTR_ACCEL_VAR
+    #define AXIS5_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS5_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS5_SERVO_FLTR_PARAM1 AXIS5_SERVO_FLTR_MEAS_VAR
+  #define AXIS5_SERVO_FLTR_PARAM2 AXIS5_SERVO_FLTR_ACCEL_VAR
+#elif AXIS5_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS5_SERVO_FLTR_ALPHA
+    #define AXIS5_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS5_SERVO_FLTR_BETA
+    #define AXIS5_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS5_SERVO_FLTR_PARAM1 AXIS5_SERVO_FLTR_ALPHA
+  #define AXIS5_SERVO_FLTR_PARAM2 AXIS5_SERVO_FLTR_BETA
+#else
+  #define AXIS5_SERVO_FLTR_PARAM1 0
+  #define AXIS5_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS6_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis6EncoderKalmanFilter(AXIS6_SERVO_FLTR_MEAS_U, AXIS6_SERVO_FLTR_MEAS_U, AXIS6_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS6_SERVO_FLTR_MEAS_VAR
+    #define AXIS6_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS6_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS6_SERVO_FLTR_ACCEL_VAR
+    #define AXIS6_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS6_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS6_SERVO_FLTR_PARAM1 AXIS6_SERVO_FLTR_MEAS_VAR
+  #define AXIS6_SERVO_FLTR_PARAM2 AXIS6_SERVO_FLTR_ACCEL_VAR
+#elif AXIS6_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS6_SERVO_FLTR_ALPHA
+    #define AXIS6_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS6_SERVO_FLTR_BETA
+    #define AXIS6_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS6_SERVO_FLTR_PARAM1 AXIS6_SERVO_FLTR_ALPHA
+  #define AXIS6_SERVO_FLTR_PARAM2 AXIS6_SERVO_FLTR_BETA
+#else
+  #define AXIS6_SERVO_FLTR_PARAM1 0
+  #define AXIS6_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS7_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis7EncoderKalmanFilter(AXIS7_SERVO_FLTR_MEAS_U, AXIS7_SERVO_FLTR_MEAS_U, AXIS7_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS7_SERVO_FLTR_MEAS_VAR
+    #define AXIS7_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS7_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS7_SERVO_FLTR_ACCEL_VAR
+    #define AXIS7_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS7_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS7_SERVO_FLTR_PARAM1 AXIS7_SERVO_FLTR_MEAS_VAR
+  #define AXIS7_SERVO_FLTR_PARAM2 AXIS7_SERVO_FLTR_ACCEL_VAR
+#elif AXIS7_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS7_SERVO_FLTR_ALPHA
+    #define AXIS7_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS7_SERVO_FLTR_BETA
+    #define AXIS7_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS7_SERVO_FLTR_PARAM1 AXIS7_SERVO_FLTR_ALPHA
+  #define AXIS7_SERVO_FLTR_PARAM2 AXIS7_SERVO_FLTR_BETA
+#else
+  #define AXIS7_SERVO_FLTR_PARAM1 0
+  #define AXIS7_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS8_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis8EncoderKalmanFilter(AXIS8_SERVO_FLTR_MEAS_U, AXIS8_SERVO_FLTR_MEAS_U, AXIS8_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS8_SERVO_FLTR_MEAS_VAR
+    #define AXIS8_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS8_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS8_SERVO_FLTR_ACCEL_VAR
+    #define AXIS8_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS8_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS8_SERVO_FLTR_PARAM1 AXIS8_SERVO_FLTR_MEAS_VAR
+  #define AXIS8_SERVO_FLTR_PARAM2 AXIS8_SERVO_FLTR_ACCEL_VAR
+#elif AXIS8_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS8_SERVO_FLTR_ALPHA
+    #define AXIS8_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS8_SERVO_FLTR_BETA
+    #define AXIS8_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS8_SERVO_FLTR_PARAM1 AXIS8_SERVO_FLTR_ALPHA
+  #define AXIS8_SERVO_FLTR_PARAM2 AXIS8_SERVO_FLTR_BETA
+#else
+  #define AXIS8_SERVO_FLTR_PARAM1 0
+  #define AXIS8_SERVO_FLTR_PARAM2 0
 #endif
 #if AXIS9_SERVO_FLTR == KALMAN
-  SimpleKalmanFilter axis9EncoderKalmanFilter(AXIS9_SERVO_FLTR_MEAS_U, AXIS9_SERVO_FLTR_MEAS_U, AXIS9_SERVO_FLTR_VARIANCE);
+  #ifndef AXIS9_SERVO_FLTR_MEAS_VAR
+    #define AXIS9_SERVO_FLTR_MEAS_VAR SERVO_FLTR_MEAS_VAR(AXIS9_SERVO_FLTR_MEAS_U)
+  #endif
+  #ifndef AXIS9_SERVO_FLTR_ACCEL_VAR
+    #define AXIS9_SERVO_FLTR_ACCEL_VAR SERVO_FLTR_ACCEL_VAR(AXIS9_SERVO_FLTR_VARIANCE)
+  #endif
+  #define AXIS9_SERVO_FLTR_PARAM1 AXIS9_SERVO_FLTR_MEAS_VAR
+  #define AXIS9_SERVO_FLTR_PARAM2 AXIS9_SERVO_FLTR_ACCEL_VAR
+#elif AXIS9_SERVO_FLTR == ALPHA_BETA
+  #ifndef AXIS9_SERVO_FLTR_ALPHA
+    #define AXIS9_SERVO_FLTR_ALPHA SERVO_OBSERVER_ALPHA
+  #endif
+  #ifndef AXIS9_SERVO_FLTR_BETA
+    #define AXIS9_SERVO_FLTR_BETA SERVO_OBSERVER_BETA
+  #endif
+  #define AXIS9_SERVO_FLTR_PARAM1 AXIS9_SERVO_FLTR_ALPHA
+  #define AXIS9_SERVO_FLTR_PARAM2 AXIS9_SERVO_FLTR_BETA
+#else
+  #define AXIS9_SERVO_FLTR_PARAM1 0
+  #define AXIS9_SERVO_FLTR_PARAM2 0
 #endif
 
-long ServoMotor::encoderApplyFilter(long encoderCounts) {
+typedef struct ServoFilterSettings {
+  int mode;
+  float param1;
+  float param2;
+} ServoFilterSettings;
+
+static const ServoFilterSettings servoFilterSettings[9] = {
+  {AXIS1_SERVO_FLTR, AXIS1_SERVO_FLTR_PARAM1, AXIS1_SERVO_FLTR_PARAM2},
+  {AXIS2_SERVO_FLTR, AXIS2_SERVO_FLTR_PARAM1, AXIS2_SERVO_FLTR_PARAM2},
+  {AXIS3_SERVO_FLTR, AXIS3_SERVO_FLTR_PARAM1, AXIS3_SERVO_FLTR_PARAM2},
+  {AXIS4_SERVO_FLTR, AXIS4_SERVO_FLTR_PARAM1, AXIS4_SERVO_FLTR_PARAM2},
+  {AXIS5_SERVO_FLTR, AXIS5_SERVO_FLTR_PARAM1, AXIS5_SERVO_FLTR_PARAM2},
+  {AXIS6_SERVO_FLTR, AXIS6_SERVO_FLTR_PARAM1, AXIS6_SERVO_FLTR_PARAM2},
+  {AXIS7_SERVO_FLTR, AXIS7_SERVO_FLTR_PARAM1, AXIS7_SERVO_FLTR_PARAM2},
+  {AXIS8_SERVO_FLTR, AXIS8_SERVO_FLTR_PARAM1, AXIS8_SERVO_FLTR_PARAM2},
+  {AXIS9_SERVO_FLTR, AXIS9_SERVO_FLTR_PARAM1, AXIS9_SERVO_FLTR_PARAM2}
+};
+
+// configure this axis encoder observer, when the filter is OFF it still runs with default
+// alpha-beta gains to estimate velocity but the raw encoder count is used for position
+void ServoMotor::encoderFilterInit() {
+  if (axisNumber < 1 || axisNumber > 9) return;
+  const ServoFilterSettings *filter = &servoFilterSettings[axisNumber - 1];
 
-  // apply Kalaman filter if enabled
-  switch (axisNumber) {
-    case 1:
-      #if AXIS1_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis1EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 2:
-      #if AXIS2_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis2EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 3:
-      #if AXIS3_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis3EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 4:
-      #if AXIS4_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis4EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 5:
-      #if AXIS5_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis5EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 6:
-      #if AXIS6_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis6EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 7:
-      #if AXIS7_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis7EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 8:
-      #if AXIS8_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis8EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-    case 9:
-      #if AXIS9_SERVO_FLTR == KALMAN
-        encoderCounts = round(axis9EncoderKalmanFilter.updateEstimate(encoderCounts));
-      #endif
-    break;
-  }
-  return encoderCounts;
+  if (filter->mode == KALMAN) observer.setKalman(filter->param1, filter->param2); else
+  if (filter->mode == ALPHA_BETA) observer.setAlphaBeta(filter->param1, filter->param2);
+  filterEnabled = filter->mode != OFF;
+}
+
+// updates the observer with the latest encoder count, returns the filtered count if enabled
+long ServoMotor::encoderApplyFilter(long encoderCounts) {
+  long estimate = observer.update(encoderCounts, micros());
+  if (filterEnabled) return estimate; else return encoderCounts;
 }
 
 #endif
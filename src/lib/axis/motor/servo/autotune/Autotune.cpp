@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------
+// servo motor relay feedback autotune
+
+#include "Autotune.h"
+
+#ifdef SERVO_MOTOR_PRESENT
+
+// start autotuning with this relay amplitude and hysteresis (in counts)
+void Autotune::start(uint8_t axisNumber, float relayAmplitude, float hysteresis, int8_t direction) {
+  axisPrefix[13] = '0' + axisNumber;
+
+  relay = fabs(relayAmplitude);
+  this->hysteresis = fabs(hysteresis);
+  this->direction = direction;
+  output = 1;
+  peakHigh = 0.0F;
+  peakLow = 0.0F;
+  amplitudeSum = 0.0F;
+  periodSum = 0.0F;
+  cycles = -2;
+  ultimateGain = 0.0F;
+  ultimatePeriod = 0.0F;
+  startTime = millis();
+  lastCycleTime = 0;
+  state = AT_RUNNING;
+
+  V(axisPrefix); VF("started with relay +/-"); V(relay); VF(" hysteresis "); VL(this->hysteresis);
+}
+
+// stop autotuning
+void Autotune::cancel() {
+  if (state == AT_RUNNING) { V(axisPrefix); VLF("cancelled"); }
+  state = AT_IDLE;
+}
+
+void Autotune::fail(const char *reason) {
+  DF("WRN: Autotune, "); DL(reason);
+  state = AT_FAILED;
+}
+
+// sets control->out from the position error in control->set and control->in
+void Autotune::poll(ServoControl *control) {
+  if (state != AT_RUNNING) return;
+
+  float error = control->set - control->in;
+
+  if ((long)(millis() - startTime) > SERVO_AUTOTUNE_TIMEOUT_MS) { fail("timed out"); control->out = 0; return; }
+  if (fabs(error) > SERVO_AUTOTUNE_MAX_ERROR) { fail("position error too large"); control->out = 0; return; }
+
+  if (error > peakHigh) peakHigh = error;
+  if (error < peakLow) peakLow = error;
+
+  if (output > 0 && error < -hysteresis) output = -1; else
+  if (output < 0 && error > hysteresis) {
+    output = 1;
+
+    // a full cycle ends on each switch back to positive output
+    unsigned long now = micros();
+    if (cycles >= 0 && lastCycleTime != 0) {
+      amplitudeSum += (peakHigh - peakLow)/2.0F;
+      periodSum += (now - lastCycleTime)/1000000.0F;
+    }
+    lastCycleTime = now;
+    peakHigh = 0.0F;
+    peakLow = 0.0F;
+    cycles++;
+
+    // samples are taken from cycle 0 on, so after the increment cycles is the sample count
+    if (cycles >= SERVO_AUTOTUNE_CYCLES) {
+      float amplitude = amplitudeSum/SERVO_AUTOTUNE_CYCLES;
+      ultimatePeriod = periodSum/SERVO_AUTOTUNE_CYCLES;
+      if (amplitude <= hysteresis || ultimatePeriod <= 0.0F) { fail("no oscillation"); control->out = 0; return; }
+
+      // describing function of a relay with hysteresis
+      ultimateGain = (4.0F*relay)/(PI*sqrtf(amplitude*amplitude - hysteresis*hysteresis));
+      state = AT_DONE;
+
+      V(axisPrefix); VF("done Ku="); V(ultimateGain); VF(" Tu="); V(ultimatePeriod); VLF("s");
+      control->out = 0;
+      return;
+    }
+  }
+
+  control->out = relay*output*direction;
+}
+
+// get the proposed PID parameters, tracking then slewing sets
+bool Autotune::getParameters(float *p, float *i, float *d, float *p_goto, float *i_goto, float *d_goto) {
+  if (state != AT_DONE) return false;
+
+  float Ku = ultimateGain;
+  float Tu = ultimatePeriod;
+
+  // Tyreus-Luyben, little overshoot for tracking
+  *p = 0.45F*Ku;
+  *i = *p/(2.2F*Tu);
+  *d = *p*(Tu/6.3F);
+
+  // classic Ziegler-Nichols, faster response for slewing
+  *p_goto = 0.6F*Ku;
+  *i_goto = *p_goto/(0.5F*Tu);
+  *d_goto = *p_goto*(0.125F*Tu);
+
+  return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------------
+// servo motor relay feedback autotune
+#pragma once
+
+#include "../feedback/Feedback.h"
+
+#ifdef SERVO_MOTOR_PRESENT
+
+#ifndef SERVO_AUTOTUNE_CYCLES
+  #define SERVO_AUTOTUNE_CYCLES 6          // number of relay cycles averaged (after two settling cycles)
+#endif
+#ifndef SERVO_AUTOTUNE_TIMEOUT_MS
+  #define SERVO_AUTOTUNE_TIMEOUT_MS 30000  // give up if the oscillation hasn't completed in this time
+#endif
+#ifndef SERVO_AUTOTUNE_MAX_ERROR
+  #define SERVO_AUTOTUNE_MAX_ERROR 2000    // give up if the position error (in counts) grows beyond this
+#endif
+
+enum AutotuneState: uint8_t {AT_IDLE, AT_RUNNING, AT_DONE, AT_FAILED};
+
+// replaces the feedback while running: the output is switched between +/- the relay amplitude as the
+// position error crosses zero, the amplitude and period of the resulting limit cycle give the ultimate
+// gain and period from which tracking (Tyreus-Luyben) and slewing (Ziegler-Nichols) PID sets are proposed
+class Autotune {
+  public:
+    // start autotuning with this relay amplitude and hysteresis (in counts)
+    void start(uint8_t axisNumber, float relayAmplitude, float hysteresis, int8_t direction);
+
+    // stop autotuning
+    void cancel();
+
+    inline bool isRunning() { return state == AT_RUNNING; }
+
+    // sets control->out from the position error in control->set and control->in
+    void poll(ServoControl *control);
+
+    // get the proposed PID parameters, tracking then slewing sets
+    // returns false if no results are available
+    bool getParameters(float *p, float *i, float *d, float *p_goto, float *i_goto, float *d_goto);
+
+    AutotuneState state = AT_IDLE;
+    float ultimateGain = 0.0F;
+    float ultimatePeriod = 0.0F;         // in seconds
+
+  private:
+    void fail(const char *reason);
+
+    float relay = 0.0F;
+    float hysteresis = 0.0F;
+    int8_t direction = 1;
+    int8_t output = 1;
+
+    float peakHigh = 0.0F;
+    float peakLow = 0.0F;
+    float amplitudeSum = 0.0F;
+    float periodSum = 0.0F;
+    int cycles = 0;
+
+    unsigned long startTime = 0;
+    unsigned long lastCycleTime = 0;
+
+    char axisPrefix[19] = "MSG: Autotune_, ";  // prefix for debug messages
+};
+
+#endif
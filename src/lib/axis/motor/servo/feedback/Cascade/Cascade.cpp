@@ -0,0 +1,121 @@
+// -----------------------------------------------------------------------------------
+// servo motor cascaded position/velocity feedback
+
+#include "Cascade.h"
+
+#ifdef SERVO_MOTOR_PRESENT
+
+Cascade::Cascade(const float P, const float VP, const float VI, const float P_goto, const float VP_goto, const float VI_goto, const float accelerationFF, const float sensitivity) {
+  setDefaultParameters(P, VP, VI, P_goto, VP_goto, VI_goto);
+  this->accelerationFF = accelerationFF;
+  useVariableParameters = (sensitivity != 0);
+  if (useVariableParameters) this->sensitivity = sensitivity; else this->sensitivity = 100;
+}
+
+// initialize control and parameters
+void Cascade::init(uint8_t axisNumber, ServoControl *control, float controlRange) {
+  Feedback::init(axisNumber, control);
+
+  axisPrefix[12] = '0' + axisNumber;
+
+  p = param1;
+  vp = param2;
+  vi = param3;
+  c = controlRange;
+
+  V(axisPrefix); VF("setting feedback with range +/-"); VL(controlRange);
+  V(axisPrefix); if (useVariableParameters) { VL("using manual parameter scaling"); } else { VL("using auto parameter scaling"); } 
+
+  control->out = 0;
+}
+
+// reset feedback control and parameters
+void Cascade::reset() {
+  V(axisPrefix); VLF("reset");
+  control->in = 0;
+  control->set = 0;
+  control->out = 0;
+  integral = 0.0F;
+  firstSample = true;
+  trackingSelected = true;
+  selectSlewingParameters();
+}
+
+void Cascade::setControlDirection(int8_t state) {
+  if (state == ON) direction = -1; else direction = 1;
+}
+
+// select param set for tracking
+void Cascade::selectTrackingParameters() {
+  if (!trackingSelected) {
+    V(axisPrefix); VL("tracking selected");
+    trackingSelected = true;
+  }
+}
+
+// select param set for slewing
+void Cascade::selectSlewingParameters() {
+  if (trackingSelected) {
+    V(axisPrefix); VL("slewing selected");
+    trackingSelected = false;
+    parameterSelect = 100;
+    p = param4;
+    vp = param5;
+    vi = param6;
+  }
+}
+
+// variable feedback, variable params
+void Cascade::variableParameters(float percent) {
+  float s = percent/sensitivity;
+  if (s < 0.0F) s = 0.0F;
+  if (s > 1.0F) s = 1.0F;
+  p = param1 + (param4 - param1)*s;
+  vp = param2 + (param5 - param2)*s;
+  vi = param3 + (param6 - param3)*s;
+}
+
+void Cascade::poll() {
+  unsigned long now = micros();
+  unsigned long elapsed = now - lastSampleTime;
+
+  if (firstSample) {
+    lastSampleTime = now;
+    firstSample = false;
+    return;
+  }
+
+  if (elapsed >= CASCADE_SAMPLE_TIME_US) {
+    float dt = elapsed/1000000.0F;
+    lastSampleTime = now;
+
+    // outer position loop, the result is the velocity reference
+    float positionError = control->set - control->in;
+    float velocityReference = control->velocity + p*positionError;
+
+    // inner velocity loop
+    float velocityError = velocityReference - control->measuredVelocity;
+    float out = vp*velocityError + integral + accelerationFF*control->acceleration;
+
+    // anti-windup, hold the integrator while taking up backlash (the encoder can't see the motor move)
+    // or while the output is saturated and more integral would only drive it further into saturation
+    bool saturatedHigh = out >= c && velocityError > 0.0F;
+    bool saturatedLow = out <= -c && velocityError < 0.0F;
+    if (!control->inBacklash && !saturatedHigh && !saturatedLow) integral += vi*velocityError*dt;
+    if (integral > c) integral = c; else if (integral < -c) integral = -c;
+
+    if (out > c) out = c; else if (out < -c) out = -c;
+    control->out = out*direction;
+  }
+
+  if (!useVariableParameters) {
+    if ((long)(millis() - nextSelectIncrementTime) > 0) {
+      if (trackingSelected) parameterSelect--;
+      if (parameterSelect < 0) parameterSelect = 0;
+      variableParameters(parameterSelect);
+      nextSelectIncrementTime = millis() + round(CASCADE_SLEWING_TO_TRACKING_TIME_MS/100.0F);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------------
+// servo motor cascaded position/velocity feedback
+#pragma once
+
+#include "../Feedback.h"
+
+#ifdef SERVO_MOTOR_PRESENT
+
+#ifndef CASCADE_SLEWING_TO_TRACKING_TIME_MS
+  #define CASCADE_SLEWING_TO_TRACKING_TIME_MS 1000 // time to switch from slewing to tracking parameters in milliseconds
+#endif
+#ifndef CASCADE_SAMPLE_TIME_US
+  #define CASCADE_SAMPLE_TIME_US 10000             // loop sample time in microseconds (defaults to 10 milliseconds)
+#endif
+
+// an outer proportional position loop commands velocity (counts/s) to an inner PI velocity loop, the commanded
+// axis velocity is added to the velocity reference and the commanded acceleration is fed forward to the output
+// parameters are position loop P, velocity loop P, velocity loop I for tracking then the same three for slewing
+class Cascade : public Feedback {
+  public:
+    Cascade(const float P, const float VP, const float VI, const float P_goto, const float VP_goto, const float VI_goto, const float accelerationFF = 0, const float sensitivity = 0);
+
+    // initialize control and parameters
+    void init(uint8_t axisNumber, ServoControl *control, float controlRange);
+
+    // reset feedback control and parameters
+    void reset();
+
+    // get driver type code so clients understand the use of the six parameters
+    char getParameterTypeCode() { return 'C'; }
+
+    // set feedback control direction
+    void setControlDirection(int8_t state);
+
+    // select param set for tracking
+    void selectTrackingParameters();
+
+    // select param set for slewing
+    void selectSlewingParameters();
+
+    // variable feedback, variable params
+    void variableParameters(float percent);
+
+    void poll();
+
+  private:
+    float p, vp, vi, c, sensitivity, accelerationFF;
+
+    int8_t direction = 1;
+
+    float integral = 0.0F;
+    unsigned long lastSampleTime = 0;
+    bool firstSample = true;
+
+    char axisPrefix[18] = "MSG: Cascade_, ";   // prefix for debug messages
+
+    int parameterSelect = 0;
+    bool trackingSelected = true;
+    unsigned long nextSelectIncrementTime = 0;
+};
+
+#endif
@@ -9,7 +9,11 @@ typedef struct ServoControl {
   float in;
   float out;
   float set;
+  float velocity;       // commanded velocity in counts per second (for feedforward)
+  float acceleration;   // commanded acceleration in counts per second per second (for feedforward)
+  float measuredVelocity; // encoder observer velocity estimate in counts per second
   volatile int8_t directionHint;
+  volatile bool inBacklash;
 } ServoControl;
 
 class Feedback {
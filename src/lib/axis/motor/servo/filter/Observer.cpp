@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------------
+// servo motor encoder position/velocity observer
+
+#include "Observer.h"
+
+#ifdef SERVO_MOTOR_PRESENT
+
+// use fixed gains
+void EncoderObserver::setAlphaBeta(float alpha, float beta) {
+  mode = OM_ALPHA_BETA;
+  this->alpha = alpha;
+  this->beta = beta;
+  initialized = false;
+}
+
+// use Kalman gains from the measurement variance and process variance
+void EncoderObserver::setKalman(float measurementVariance, float processVariance) {
+  mode = OM_KALMAN;
+  r = measurementVariance;
+  q = processVariance;
+  initialized = false;
+}
+
+// restart the estimate at this count with zero velocity
+void EncoderObserver::reset(long counts) {
+  base = counts;
+  offset = 0.0F;
+  velocity = 0.0F;
+  p11 = r; p12 = 0.0F; p22 = r;
+  initialized = false;
+}
+
+// update with an encoder count taken at this time
+long EncoderObserver::update(long counts, unsigned long timeMicros) {
+  float dt = (timeMicros - lastTime)/1000000.0F;
+
+  // start over if this is the first sample or they've been too far apart to predict across
+  if (!initialized || dt > 0.5F) {
+    reset(counts);
+    lastTime = timeMicros;
+    initialized = true;
+    return counts;
+  }
+  if (dt <= 0.0F) return base + lroundf(offset);
+  lastTime = timeMicros;
+
+  // predict
+  offset += velocity*dt;
+
+  // correct
+  float residual = (float)(counts - base) - offset;
+  if (mode == OM_KALMAN) {
+    float dt2 = dt*dt;
+    p11 += dt*(2.0F*p12 + dt*p22) + q*dt2*dt2/4.0F;
+    p12 += dt*p22 + q*dt2*dt/2.0F;
+    p22 += q*dt2;
+
+    float s = p11 + r;
+    float k1 = p11/s;
+    float k2 = p12/s;
+    offset += k1*residual;
+    velocity += k2*residual;
+
+    p22 -= k2*p12;
+    p12 -= k1*p12;
+    p11 -= k1*p11;
+  } else {
+    offset += alpha*residual;
+    velocity += (beta/dt)*residual;
+  }
+
+  // move the base to the latest count
+  offset -= (float)(counts - base);
+  base = counts;
+
+  return base + lroundf(offset);
+}
+
+#endif
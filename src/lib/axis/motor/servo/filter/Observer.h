@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------
+// servo motor encoder position/velocity observer
+#pragma once
+
+#include "../../../../../Common.h"
+
+#ifdef SERVO_MOTOR_PRESENT
+
+#ifndef SERVO_OBSERVER_ALPHA
+  #define SERVO_OBSERVER_ALPHA 0.5F  // default alpha-beta position gain
+#endif
+#ifndef SERVO_OBSERVER_BETA
+  #define SERVO_OBSERVER_BETA 0.05F  // default alpha-beta velocity gain
+#endif
+
+enum ObserverMode: uint8_t {OM_ALPHA_BETA, OM_KALMAN};
+
+// estimates position and velocity from timestamped encoder counts, either with fixed alpha-beta gains
+// or a two-state (position, velocity) Kalman filter with white noise acceleration
+// the estimate is kept as an offset from the last count so float precision isn't lost on large counts
+class EncoderObserver {
+  public:
+    // use fixed gains
+    void setAlphaBeta(float alpha, float beta);
+
+    // use Kalman gains from the measurement variance (counts^2) and process variance (counts^2/s^4)
+    void setKalman(float measurementVariance, float processVariance);
+
+    // restart the estimate at this count with zero velocity
+    void reset(long counts);
+
+    // update with an encoder count taken at this time
+    // returns the estimated position in counts
+    long update(long counts, unsigned long timeMicros);
+
+    // estimated velocity in counts per second
+    inline float getVelocity() { return velocity; }
+
+  private:
+    ObserverMode mode = OM_ALPHA_BETA;
+    float alpha = SERVO_OBSERVER_ALPHA;
+    float beta = SERVO_OBSERVER_BETA;
+    float r = 1.0F;
+    float q = 1.0F;
+
+    long base = 0;
+    float offset = 0.0F;
+    float velocity = 0.0F;
+    float p11 = 1.0F, p12 = 0.0F, p22 = 1.0F;
+
+    unsigned long lastTime = 0;
+    bool initialized = false;
+};
+
+#endif
@@ -134,7 +134,7 @@ void ServoTmc2209::init() {
 // move using step/dir signals
 void ServoTmc2209::alternateMode(bool state) {
   sdMode = state;
-  if (sdMode) driver->VACTUAL(0);
+  if (sdMode && shadow.changed(TSR_VELOCITY, 0)) driver->VACTUAL(0);
 }
 
 // enable or disable the driver using the enable pin or other method
@@ -157,6 +157,7 @@ void ServoTmc2209::enable(bool state) {
   }
 
   currentVelocity = 0.0F;
+  shadow.invalidate();
 
   ServoDriver::updateStatus();
 }
@@ -180,7 +181,9 @@ float ServoTmc2209::setMotorVelocity(float velocity) {
 
   if (currentVelocity >= 0.0F) motorDirection = DIR_FORWARD; else motorDirection = DIR_REVERSE;
 
-  driver->VACTUAL(currentVelocity/0.715F);
+  // VACTUAL is only written when the requested velocity actually changes
+  int32_t vactual = currentVelocity/0.715F;
+  if (shadow.changed(TSR_VELOCITY, (uint32_t)vactual)) driver->VACTUAL(vactual);
 
   return currentVelocity;
 }
@@ -188,8 +191,7 @@ float ServoTmc2209::setMotorVelocity(float velocity) {
 // update status info. for driver
 void ServoTmc2209::updateStatus() {
   if (statusMode == ON) {
-    if ((long)(millis() - timeLastStatusUpdate) > 200) {
-
+    if (shadow.statusDue()) {
       TMC2208_n::DRV_STATUS_t status_result;
       status_result.sr = driver->DRV_STATUS();
       status.outputA.shortToGround = status_result.s2ga;
@@ -205,8 +207,6 @@ void ServoTmc2209::updateStatus() {
           status.outputB.shortToGround ||
           status.overTemperatureWarning ||
           status.overTemperature) status.fault = true; else status.fault = false;
-
-      timeLastStatusUpdate = millis();
     }
   } else
   if (statusMode == LOW || statusMode == HIGH) {
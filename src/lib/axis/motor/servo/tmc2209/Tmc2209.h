@@ -8,6 +8,7 @@
 #ifdef SERVO_TMC2209_PRESENT
 
 #include "../ServoDriver.h"
+#include "../../TmcShadow.h"
 
 #ifndef DRIVER_TMC_STEPPER_AUTOGRAD
   #define DRIVER_TMC_STEPPER_AUTOGRAD true
@@ -94,6 +95,7 @@ class ServoTmc2209 : public ServoDriver {
     float currentVelocity = 0.0F;
     float acceleration;
     float accelerationFs;
+    TmcShadow shadow;
     const ServoTmcPins *Pins;
 };
 
@@ -107,6 +107,7 @@ void ServoTmc5160::enable(bool state) {
   }
 
   currentVelocity = 0.0F;
+  shadow.invalidate();
 
   ServoDriver::updateStatus();
 }
@@ -126,15 +127,12 @@ float ServoTmc5160::setMotorVelocity(float velocity) {
     if (currentVelocity < velocity) currentVelocity = velocity;
   }
 
-  if (currentVelocity >= 0.0F) {
-    driver->shaft(false);
-    motorDirection = DIR_FORWARD;
-  } else {
-    driver->shaft(true);
-    motorDirection = DIR_REVERSE;
-  }
+  if (currentVelocity >= 0.0F) motorDirection = DIR_FORWARD; else motorDirection = DIR_REVERSE;
 
-  driver->VMAX(abs(currentVelocity/0.715F));
+  // shaft and VMAX are only written when they actually change
+  if (shadow.changed(TSR_DIRECTION, motorDirection)) driver->shaft(motorDirection == DIR_REVERSE);
+  uint32_t vmax = abs(currentVelocity/0.715F);
+  if (shadow.changed(TSR_VELOCITY, vmax)) driver->VMAX(vmax);
 
   return currentVelocity;
 }
@@ -142,8 +140,7 @@ float ServoTmc5160::setMotorVelocity(float velocity) {
 // update status info. for driver
 void ServoTmc5160::updateStatus() {
   if (statusMode == ON) {
-    if ((long)(millis() - timeLastStatusUpdate) > 200) {
-
+    if (shadow.statusDue()) {
       TMC2208_n::DRV_STATUS_t status_result;
       status_result.sr = driver->DRV_STATUS();
       status.outputA.shortToGround = status_result.s2ga;
@@ -159,8 +156,6 @@ void ServoTmc5160::updateStatus() {
           status.outputB.shortToGround ||
           status.overTemperatureWarning ||
           status.overTemperature) status.fault = true; else status.fault = false;
-
-      timeLastStatusUpdate = millis();
     }
   } else
   if (statusMode == LOW || statusMode == HIGH) {
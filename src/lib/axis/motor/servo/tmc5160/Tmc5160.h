@@ -8,6 +8,7 @@
 #ifdef SERVO_TMC5160_PRESENT
 
 #include "../ServoDriver.h"
+#include "../../TmcShadow.h"
 
 #ifndef DRIVER_TMC_STEPPER_AUTOGRAD
   #define DRIVER_TMC_STEPPER_AUTOGRAD true
@@ -77,6 +78,7 @@ class ServoTmc5160 : public ServoDriver {
     float currentVelocity = 0.0F;
     float acceleration;
     float accelerationFs;
+    TmcShadow shadow;
     const ServoTmcSpiPins *Pins;
 };
 
@@ -9,64 +9,71 @@
 
 StepDirMotor *stepDirMotorInstance[9];
 
+// step pins not known at compile time are written through their GPIO registers where supported
+#ifdef HAL_HAS_FAST_PIN_REGISTERS
+  #define STEP_PIN_RUNTIME(i) stepDirMotorInstance[i]->fastStepPin
+#else
+  #define STEP_PIN_RUNTIME(i) stepDirMotorInstance[i]->Pins->step
+#endif
+
 #ifndef AXIS1_STEP_PIN
-  #define AXIS1_STEP_PIN stepDirMotorInstance[0]->Pins->step
+  #define AXIS1_STEP_PIN STEP_PIN_RUNTIME(0)
 #endif
 IRAM_ATTR void moveStepDirMotorAxis1() { stepDirMotorInstance[0]->move(AXIS1_STEP_PIN); }
 IRAM_ATTR void moveStepDirMotorFFAxis1() { stepDirMotorInstance[0]->moveFF(AXIS1_STEP_PIN); }
 IRAM_ATTR void moveStepDirMotorFRAxis1() { stepDirMotorInstance[0]->moveFR(AXIS1_STEP_PIN); }
 
 #ifndef AXIS2_STEP_PIN
-  #define AXIS2_STEP_PIN stepDirMotorInstance[1]->Pins->step
+  #define AXIS2_STEP_PIN STEP_PIN_RUNTIME(1)
 #endif
 IRAM_ATTR void moveStepDirMotorAxis2() { stepDirMotorInstance[1]->move(AXIS2_STEP_PIN); }
 IRAM_ATTR void moveStepDirMotorFFAxis2() { stepDirMotorInstance[1]->moveFF(AXIS2_STEP_PIN); }
 IRAM_ATTR void moveStepDirMotorFRAxis2() { stepDirMotorInstance[1]->moveFR(AXIS2_STEP_PIN); }
 
 #ifndef AXIS3_STEP_PIN
-  #define AXIS3_STEP_PIN stepDirMotorInstance[2]->Pins->step
+  #define AXIS3_STEP_PIN STEP_PIN_RUNTIME(2)
 #endif
 void moveStepDirMotorAxis3() { stepDirMotorInstance[2]->move(AXIS3_STEP_PIN); }
 void moveStepDirMotorFFAxis3() { stepDirMotorInstance[2]->moveFF(AXIS3_STEP_PIN); }
 void moveStepDirMotorFRAxis3() { stepDirMotorInstance[2]->moveFR(AXIS3_STEP_PIN); }
 
 #ifndef AXIS4_STEP_PIN
-  #define AXIS4_STEP_PIN stepDirMotorInstance[3]->Pins->step
+  #define AXIS4_STEP_PIN STEP_PIN_RUNTIME(3)
 #endif
 void moveStepDirMotorAxis4() { stepDirMotorInstance[3]->move(AXIS4_STEP_PIN); }
 void moveStepDirMotorFFAxis4() { stepDirMotorInstance[3]->moveFF(AXIS4_STEP_PIN); }
 void moveStepDirMotorFRAxis4() { stepDirMotorInstance[3]->moveFR(AXIS4_STEP_PIN); }
 
 #ifndef AXIS5_STEP_PIN
-  #define AXIS5_STEP_PIN stepDirMotorInstance[4]->Pins->step
+  #define AXIS5_STEP_PIN STEP_PIN_RUNTIME(4)
 #endif
 void moveStepDirMotorAxis5() { stepDirMotorInstance[4]->move(AXIS5_STEP_PIN); }
 void moveStepDirMotorFFAxis5() { stepDirMotorInstance[4]->moveFF(AXIS5_STEP_PIN); }
 void moveStepDirMotorFRAxis5() { stepDirMotorInstance[4]->moveFR(AXIS5_STEP_PIN); }
 
 #ifndef AXIS6_STEP_PIN
-  #define AXIS6_STEP_PIN stepDirMotorInstance[5]->Pins->step
+  #define AXIS6_STEP_PIN STEP_PIN_RUNTIME(5)
 #endif
 void moveStepDirMotorAxis6() { stepDirMotorInstance[5]->move(AXIS6_STEP_PIN); }
 void moveStepDirMotorFFAxis6() { stepDirMotorInstance[5]->moveFF(AXIS6_STEP_PIN); }
 void moveStepDirMotorFRAxis6() { stepDirMotorInstance[5]->moveFR(AXIS6_STEP_PIN); }
 
 #ifndef AXIS7_STEP_PIN
-  #define AXIS7_STEP_PIN stepDirMotorInstance[6]->Pins->step
+  #define AXIS7_STEP_PIN STEP_PIN_RUNTIME(6)
 #endif
 void moveStepDirMotorAxis7() { stepDirMotorInstance[6]->move(AXIS7_STEP_PIN); }
 void moveStepDirMotorFFAxis7() { stepDirMotorInstance[6]->moveFF(AXIS7_STEP_PIN); }
 void moveStepDirMotorFRAxis7() { stepDirMotorInstance[6]->moveFR(AXIS7_STEP_PIN); }
 
 #ifndef AXIS8_STEP_PIN
-  #define AXIS8_STEP_PIN stepDirMotorInstance[7]->Pins->step
+  #define AXIS8_STEP_PIN STEP_PIN_RUNTIME(7)
 #endif
 void moveStepDirMotorAxis8() { stepDirMotorInstance[7]->move(AXIS8_STEP_PIN); }
 void moveStepDirMotorFFAxis8() { stepDirMotorInstance[7]->moveFF(AXIS8_STEP_PIN); }
 void moveStepDirMotorFRAxis8() { stepDirMotorInstance[7]->moveFR(AXIS8_STEP_PIN); }
 
 #ifndef AXIS9_STEP_PIN
-  #define AXIS9_STEP_PIN stepDirMotorInstance[8]->Pins->step
+  #define AXIS9_STEP_PIN STEP_PIN_RUNTIME(8)
 #endif
 void moveStepDirMotorAxis9() { stepDirMotorInstance[8]->move(AXIS9_STEP_PIN); }
 void moveStepDirMotorFFAxis9() { stepDirMotorInstance[8]->moveFF(AXIS9_STEP_PIN); }
@@ -129,6 +136,18 @@ bool StepDirMotor::init() {
   pinModeEx(Pins->step, OUTPUT);
   digitalWriteF(Pins->step, stepClr);
 
+  // resolve the step pin to its GPIO registers
+  #ifdef HAL_HAS_FAST_PIN_REGISTERS
+    fastStepPin.pin = Pins->step;
+    if (Pins->step >= 0 && Pins->step < 0x100) {
+      fastStepPin.setReg = HAL_FAST_PIN_SET_REG(Pins->step);
+      fastStepPin.setMask = HAL_FAST_PIN_SET_MASK(Pins->step);
+      fastStepPin.clearReg = HAL_FAST_PIN_CLR_REG(Pins->step);
+      fastStepPin.clearMask = HAL_FAST_PIN_CLR_MASK(Pins->step);
+    }
+    if (fastStepPin.setReg != NULL) { V(axisPrefix); VLF("step pin using GPIO registers"); }
+  #endif
+
   // init default driver enable pin
   pinModeEx(Pins->enable, OUTPUT);
   digitalWriteEx(Pins->enable, !Pins->enabledState)
@@ -160,6 +179,10 @@ void StepDirMotor::setReverse(int8_t state) {
 void StepDirMotor::setParameters(float param1, float param2, float param3, float param4, float param5, float param6) {
   driver->init(param1, param2, param3, param4, param5, param6);
   homeSteps = driver->getMicrostepRatio();
+  homeMask = homeSteps - 1;
+  #if STEP_DIR_MODE_SWITCH_SEAMLESS == ON
+    modeSwitchSeamless = driver->modeSwitchIsrAllowed;
+  #endif
   V(axisPrefix); VF("sequencer homes every "); V(homeSteps); VLF(" step(s)");
 }
 
@@ -213,11 +236,15 @@ void StepDirMotor::setFrequencySteps(float frequency) {
   // microstep mode and/or swap in fast ISRs as required
   if (inBacklash) frequency = backlashFrequency;
 
-  if (frequency != currentFrequency || microstepModeControl >= MMC_SLEWING_PAUSE) {
+  // the step ISR can move the mode on from MMC_SLEWING_REQUEST at any time, work from one snapshot
+  // so the period and the mode changes below agree, a change made after it is picked up next time
+  MicrostepModeControl modeControl = microstepModeControl;
+
+  if (frequency != currentFrequency || modeControl >= MMC_SLEWING_PAUSE || modeControl == MMC_SLEWING_SEAMLESS) {
     lastFrequency = frequency;
 
     // if slewing has a larger step size divide the frequency to account for it
-    if (microstepModeControl == MMC_SLEWING || microstepModeControl == MMC_SLEWING_READY) frequency /= stepSize;
+    if (modeControl == MMC_SLEWING || modeControl == MMC_SLEWING_READY || modeControl == MMC_SLEWING_SEAMLESS) frequency /= stepSize;
 
     // frequency in steps per second to period in microsecond counts per step
     // also runs the timer twice as fast if using a square wave
@@ -247,10 +274,19 @@ void StepDirMotor::setFrequencySteps(float frequency) {
     }
     step = dir;
 
-    if (microstepModeControl == MMC_TRACKING_READY) microstepModeControl = MMC_TRACKING;
-    if (microstepModeControl == MMC_SLEWING_READY) {
+    if (modeControl == MMC_TRACKING_READY) microstepModeControl = MMC_TRACKING;
+    if (modeControl == MMC_SLEWING_SEAMLESS) {
+      // the driver is already in slewing mode, now that the period is set the fast ISR takes over
+      enableMoveFast(true);
+      microstepModeControl = MMC_SLEWING;
+      #if DEBUG == VERBOSE
+        V(axisPrefix); VF("high speed seamless swap in took "); V(micros() - switchStartTimeUs); VLF(" us");
+      #endif
+    }
+    if (modeControl == MMC_SLEWING_READY) {
       #if DEBUG == VERBOSE
-        V(axisPrefix); VF("high speed swap in took "); V(millis() - switchStartTimeMs); VLF(" ms");
+        V(axisPrefix); VF("high speed swap in took "); V(micros() - switchStartTimeUs);
+        VF(" us, "); V(pausedTicks); VLF(" step period(s) paused");
       #endif
       microstepModeControl = MMC_SLEWING;
     }
@@ -281,8 +317,9 @@ void StepDirMotor::modeSwitch() {
       if (!sync || (step == -1 && direction == dirRev) || (step == 1 && direction == dirFwd)) {
         microstepModeControl = MMC_SLEWING_REQUEST;
       }
+      pausedTicks = 0;
       interrupts();
-      switchStartTimeMs = millis();
+      switchStartTimeUs = micros();
     } else
     if (microstepModeControl == MMC_SLEWING_PAUSE) {
       if (driver->modeSwitchAllowed || driver->modeSwitchFastAllowed) {
@@ -340,20 +377,33 @@ bool StepDirMotor::enableMoveFast(const bool fast) {
   }
 #endif
 
-IRAM_ATTR void StepDirMotor::move(const int16_t stepPin) {
+template <typename StepPin> IRAM_ATTR void StepDirMotor::move(const StepPin &stepPin) {
   #if STEP_WAVE_FORM == PULSE
-    digitalWriteF(stepPin, stepClr);
+    stepPinWrite(stepPin, stepClr);
   #endif
 
   #ifdef GPIO_DIRECTION_PINS
     if (direction > DirNone) return;
   #endif
 
-  if (microstepModeControl == MMC_SLEWING_REQUEST && (motorSteps + backlashSteps) % homeSteps == 0 && direction < DirNone) {
-    microstepModeControl = MMC_SLEWING_PAUSE;
+  if (microstepModeControl == MMC_SLEWING_REQUEST && ((motorSteps + backlashSteps) & homeMask) == 0 && direction < DirNone) {
+    if (modeSwitchSeamless) {
+      // switch the driver now and keep stepping (stepSize at a time, once every stepSize ticks)
+      // until the timer period is adjusted and the fast ISR swapped in
+      stepSize = driver->modeMicrostepSlewing();
+      seamlessTicks = 0;
+      microstepModeControl = MMC_SLEWING_SEAMLESS;
+    } else microstepModeControl = MMC_SLEWING_PAUSE;
     tasks.immediate(monitorHandle);
   }
-  if (microstepModeControl >= MMC_SLEWING_PAUSE) return;
+  if (microstepModeControl == MMC_SLEWING_SEAMLESS) {
+    if (++seamlessTicks >= stepSize) {
+      seamlessTicks = 0;
+      if (direction == dirRev) moveFR(stepPin); else moveFF(stepPin);
+    }
+    return;
+  }
+  if (microstepModeControl >= MMC_SLEWING_PAUSE) { pausedTicks++; return; }
 
   #if STEP_WAVE_FORM == SQUARE
     if (takeStep) {
@@ -385,7 +435,7 @@ IRAM_ATTR void StepDirMotor::move(const int16_t stepPin) {
     #ifdef SHARED_DIRECTION_PINS
       if (axisNumber > 2) { digitalWriteF(Pins->dir, direction); delayNanoseconds(pulseWidth); }
     #endif
-    digitalWriteF(stepPin, stepSet);
+    stepPinWrite(stepPin, stepSet);
   } else
 
   if (motorSteps < targetSteps || (inBacklash && direction == dirFwd)) {
@@ -411,19 +461,19 @@ IRAM_ATTR void StepDirMotor::move(const int16_t stepPin) {
     #ifdef SHARED_DIRECTION_PINS
       if (axisNumber > 2) { digitalWriteF(Pins->dir, direction); delayNanoseconds(pulseWidth); }
     #endif
-    digitalWriteF(stepPin, stepSet);
+    stepPinWrite(stepPin, stepSet);
 
   } else if (!inBacklash) direction = DirNone;
 
   #if STEP_WAVE_FORM == SQUARE
-    } else digitalWriteF(stepPin, stepClr);
+    } else stepPinWrite(stepPin, stepClr);
     takeStep = !takeStep;
   #endif
 }
 
-IRAM_ATTR void StepDirMotor::moveFF(const int16_t stepPin) {
+template <typename StepPin> IRAM_ATTR void StepDirMotor::moveFF(const StepPin &stepPin) {
   #if STEP_WAVE_FORM == PULSE
-    digitalWriteF(stepPin, stepClr);
+    stepPinWrite(stepPin, stepClr);
   #endif
 
   if (microstepModeControl >= MMC_SLEWING_PAUSE) return;
@@ -440,18 +490,18 @@ IRAM_ATTR void StepDirMotor::moveFF(const int16_t stepPin) {
     #ifdef SHARED_DIRECTION_PINS
       if (axisNumber > 2) { digitalWriteF(Pins->dir, direction); delayNanoseconds(pulseWidth); }
     #endif
-    digitalWriteF(stepPin, stepSet);
+    stepPinWrite(stepPin, stepSet);
   }
 
   #if STEP_WAVE_FORM == SQUARE
-    } else digitalWriteF(stepPin, stepClr);
+    } else stepPinWrite(stepPin, stepClr);
     takeStep = !takeStep;
   #endif
 }
 
-IRAM_ATTR void StepDirMotor::moveFR(const int16_t stepPin) {
+template <typename StepPin> IRAM_ATTR void StepDirMotor::moveFR(const StepPin &stepPin) {
   #if STEP_WAVE_FORM == PULSE
-    digitalWriteF(stepPin, stepClr);
+    stepPinWrite(stepPin, stepClr);
   #endif
 
   if (microstepModeControl >= MMC_SLEWING_PAUSE) return;
@@ -468,11 +518,11 @@ IRAM_ATTR void StepDirMotor::moveFR(const int16_t stepPin) {
     #ifdef SHARED_DIRECTION_PINS
       if (axisNumber > 2) { digitalWriteF(Pins->dir, direction); delayNanoseconds(pulseWidth); }
     #endif
-    digitalWriteF(stepPin, stepSet);
+    stepPinWrite(stepPin, stepSet);
   }
 
   #if STEP_WAVE_FORM == SQUARE
-    } else digitalWriteF(stepPin, stepClr);
+    } else stepPinWrite(stepPin, stepClr);
     takeStep = !takeStep;
   #endif
 }
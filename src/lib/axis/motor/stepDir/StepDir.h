@@ -17,6 +17,12 @@
 #include "tmcStepper/StepperUART.h"
 #include "../Motor.h"
 
+// switch microstep modes for drivers that can do so instantly (M0/M1/M2 pins on the MCU) right in the
+// step ISR at the home step, without pausing the motor
+#ifndef STEP_DIR_MODE_SWITCH_SEAMLESS
+  #define STEP_DIR_MODE_SWITCH_SEAMLESS ON
+#endif
+
 typedef struct StepDirPins {
   int16_t step;
   uint8_t stepState;
@@ -25,11 +31,30 @@ typedef struct StepDirPins {
   uint8_t enabledState;
 } StepDirPins;
 
+#ifdef HAL_HAS_FAST_PIN_REGISTERS
+  // a step pin resolved to its GPIO set/clear registers and bit masks at init so the step ISRs
+  // write it directly, pins without registers (GPIO expander, etc.) have setReg NULL
+  typedef struct FastPin {
+    volatile uint32_t *setReg;
+    volatile uint32_t *clearReg;
+    uint32_t setMask;
+    uint32_t clearMask;
+    int16_t pin;
+  } FastPin;
+
+  inline void stepPinWrite(const FastPin &stepPin, const uint8_t state) {
+    if (stepPin.setReg == NULL) { digitalWriteF(stepPin.pin, state); return; }
+    if (state == HIGH) *stepPin.setReg = stepPin.setMask; else *stepPin.clearReg = stepPin.clearMask;
+  }
+#endif
+
+inline void stepPinWrite(const int16_t stepPin, const uint8_t state) { digitalWriteF(stepPin, state); }
+
 #define DirNone 253
 #define DirSetRev 254
 #define DirSetFwd 255
 
-enum MicrostepModeControl: uint8_t {MMC_TRACKING, MMC_SLEWING, MMC_SLEWING_REQUEST, MMC_SLEWING_PAUSE, MMC_SLEWING_READY, MMC_TRACKING_READY};
+enum MicrostepModeControl: uint8_t {MMC_TRACKING, MMC_SLEWING, MMC_SLEWING_SEAMLESS, MMC_SLEWING_REQUEST, MMC_SLEWING_PAUSE, MMC_SLEWING_READY, MMC_TRACKING_READY};
 
 class StepDirMotor : public Motor {
   public:
@@ -91,13 +116,19 @@ class StepDirMotor : public Motor {
     #endif
 
     // sets dir as required and moves coord toward target at setFrequencySteps() rate
-    void move(const int16_t stepPin);
+    // the step pin is either a pin number or a FastPin
+    template <typename StepPin> void move(const StepPin &stepPin);
 
     // fast forward axis movement, no backlash, no mode switching
-    void moveFF(const int16_t stepPin);
+    template <typename StepPin> void moveFF(const StepPin &stepPin);
 
     // fast reverse axis movement, no backlash, no mode switching
-    void moveFR(const int16_t stepPin);
+    template <typename StepPin> void moveFR(const StepPin &stepPin);
+
+    #ifdef HAL_HAS_FAST_PIN_REGISTERS
+      // the step pin as resolved at init
+      FastPin fastStepPin = {NULL, NULL, 0, 0, OFF};
+    #endif
 
     // a stepper motor driver, should not be used above the StepDir class
     StepDirDriver *driver;
@@ -121,6 +152,10 @@ class StepDirMotor : public Motor {
     volatile uint32_t pulseWidth = 2000; // step/dir driver pulse width in nanoseconds
 
     volatile int16_t homeSteps = 1;      // step count for microstep sequence between home positions (driver indexer)
+    volatile int16_t homeMask = 0;       // homeSteps is a power of two, at a home position when (steps & homeMask) == 0
+    volatile bool modeSwitchSeamless = false; // microstep mode switches happen in the step ISR
+    volatile int16_t seamlessTicks = 0;  // counts timer ticks so seamless slewing steps at the old rate until the period is set
+    volatile uint16_t pausedTicks = 0;   // timer ticks without a step during a microstep mode switch
     volatile int16_t stepSize = 1;       // step size during slews (for micro-step mode switching)
     volatile bool takeStep = false;      // should we take a step
 
@@ -128,7 +163,7 @@ class StepDirMotor : public Motor {
     float lastFrequency = 0.0F;          // last frequency requested
     unsigned long lastPeriod = 0;        // last timer period (in sub-micros)
     unsigned long lastPeriodSet = 0;     // last timer period actually set (in sub-micros)
-    unsigned long switchStartTimeMs;     // log time to switch microstep mode and do ISR swap
+    unsigned long switchStartTimeUs;     // log time to switch microstep mode and do ISR swap
 
     volatile MicrostepModeControl microstepModeControl = MMC_TRACKING;
 
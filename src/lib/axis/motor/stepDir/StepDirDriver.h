@@ -80,6 +80,9 @@ class StepDirDriver {
     // true if switching microstep modes at high speed is allowed
     bool modeSwitchFastAllowed = false;
 
+    // true if the microstep mode can be switched from inside the step ISR (mode pins directly on the MCU)
+    bool modeSwitchIsrAllowed = false;
+
     StepDirDriverSettings settings;
 
   protected:
@@ -90,7 +93,6 @@ class StepDirDriver {
     #if DEBUG != OFF
       DriverStatus lastStatus = {false, {false, false}, {false, false}, false, false, false, false};
     #endif
-    unsigned long timeLastStatusUpdate = 0;
 
     const int16_t* microsteps;
     int16_t microstepRatio = 1;
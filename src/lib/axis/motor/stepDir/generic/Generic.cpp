@@ -80,6 +80,9 @@ void StepDirGeneric::init(float param1, float param2, float param3, float param4
   // use low speed mode switch for TMC drivers or high speed otherwise
   modeSwitchAllowed = false;
   modeSwitchFastAllowed = microstepRatio != 1;
+
+  // mode pins on a GPIO expander or DAC are too slow to write from the step ISR
+  modeSwitchIsrAllowed = modeSwitchFastAllowed && m0Pin < 0x100 && m1Pin < 0x100 && m2Pin < 0x100;
 }
 
 IRAM_ATTR void StepDirGeneric::modeMicrostepTracking() {
@@ -124,7 +124,7 @@ void StepDirTmcSPI::modeDecaySlewing() {
 
 void StepDirTmcSPI::updateStatus() {
   if (settings.status == ON) {
-    if ((long)(millis() - timeLastStatusUpdate) > 200) {
+    if (shadow.statusDue()) {
       if (driver.refresh_DRVSTATUS()) {
         status.outputA.shortToGround = driver.get_DRVSTATUS_s2gA();
         status.outputA.openLoad      = driver.get_DRVSTATUS_olA();
@@ -133,6 +133,9 @@ void StepDirTmcSPI::updateStatus() {
         status.overTemperatureWarning = driver.get_DRVSTATUS_otpw();
         status.overTemperature       = driver.get_DRVSTATUS_ot();
         status.standstill            = driver.get_DRVSTATUS_stst();
+        status.load                  = driver.get_DRVSTATUS_result();
+        status.currentScale          = driver.get_DRVSTATUS_cs_actual();
+        status.loadValid             = true;
 
         // open load indication is not reliable in standstill
         if (
@@ -150,9 +153,8 @@ void StepDirTmcSPI::updateStatus() {
         status.overTemperature       = true;
         status.standstill            = true;
         status.fault                 = true;
+        status.loadValid             = false;
       }
-
-      timeLastStatusUpdate = millis();
     }
   } else
   if (settings.status == LOW || settings.status == HIGH) {
@@ -165,6 +167,7 @@ void StepDirTmcSPI::updateStatus() {
 // secondary way to power down not using the enable pin
 bool StepDirTmcSPI::enable(bool state) {
   if (state) {
+    driver.invalidate();
     driver.mode(settings.intpol, settings.decay, microstepCode, settings.currentRun, settings.currentHold);
   } else {
     driver.mode(settings.intpol, STEALTHCHOP, microstepCode, settings.currentRun, 0);
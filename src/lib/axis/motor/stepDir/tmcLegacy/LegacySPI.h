@@ -8,6 +8,7 @@
 #if !defined(DRIVER_TMC_STEPPER) && defined(STEP_DIR_TMC_SPI_PRESENT)
 
 #include "TmcSPI.h"
+#include "../../TmcShadow.h"
 #include "../StepDirDriver.h"
 
 class StepDirTmcSPI : public StepDirDriver {
@@ -48,6 +49,8 @@ class StepDirTmcSPI : public StepDirDriver {
     TmcSPI driver;
 
   private:
+    TmcShadow shadow;
+
     // checks if decay pin should be HIGH/LOW for a given decay setting
     int8_t getDecayPinState(int8_t decay);
 };
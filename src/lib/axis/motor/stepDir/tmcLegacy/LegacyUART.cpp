@@ -161,33 +161,42 @@ bool StepDirTmcUART::validateParameters(float param1, float param2, float param3
 }
 
 void StepDirTmcUART::modeMicrostepTracking() {
+  if (!shadow.changed(TSR_MICROSTEPS, settings.microsteps)) return;
   driver->setMicrostepsPerStep(settings.microsteps);
 }
 
 int StepDirTmcUART::modeMicrostepSlewing() {
-  if (microstepRatio > 1) {
+  if (microstepRatio > 1 && shadow.changed(TSR_MICROSTEPS, settings.microstepsSlewing)) {
     driver->setMicrostepsPerStep(settings.microstepsSlewing);
   }
   return microstepRatio;
 }
 
 void StepDirTmcUART::modeDecayTracking() {
-  if (settings.decay == SPREADCYCLE) driver->disableStealthChop(); else driver->enableStealthChop();
-  driver->setRunCurrent(settings.currentRun/25); // current in %
-  driver->setHoldCurrent(settings.currentHold/25); // current in %
-}  
+  if (shadow.changed(TSR_DECAY, settings.decay)) {
+    if (settings.decay == SPREADCYCLE) driver->disableStealthChop(); else driver->enableStealthChop();
+  }
+  if (shadow.changed(TSR_CURRENT, ((uint32_t)settings.currentRun << 16) | (uint16_t)settings.currentHold)) {
+    driver->setRunCurrent(settings.currentRun/25); // current in %
+    driver->setHoldCurrent(settings.currentHold/25); // current in %
+  }
+}
 
 void StepDirTmcUART::modeDecaySlewing() {
   int IGOTO = settings.currentGoto;
   if (IGOTO == OFF) IGOTO = settings.currentRun;
-  if (settings.decaySlewing == SPREADCYCLE) driver->disableStealthChop(); else driver->enableStealthChop();
-  driver->setRunCurrent(IGOTO/25); // current in %
-  driver->setHoldCurrent(settings.currentHold/25); // current in %
+  if (shadow.changed(TSR_DECAY, settings.decaySlewing)) {
+    if (settings.decaySlewing == SPREADCYCLE) driver->disableStealthChop(); else driver->enableStealthChop();
+  }
+  if (shadow.changed(TSR_CURRENT, ((uint32_t)IGOTO << 16) | (uint16_t)settings.currentHold)) {
+    driver->setRunCurrent(IGOTO/25); // current in %
+    driver->setHoldCurrent(settings.currentHold/25); // current in %
+  }
 }
 
 void StepDirTmcUART::updateStatus() {
   if (settings.status == ON) {
-    if ((long)(millis() - timeLastStatusUpdate) > 200) {
+    if (shadow.statusDue()) {
       TMC2209Stepper::Status tmc2209Status = driver->getStatus();
       status.outputA.shortToGround = (bool)tmc2209Status.short_to_ground_a || (bool)tmc2209Status.low_side_short_a;
       status.outputA.openLoad      = (bool)tmc2209Status.open_load_a;
@@ -196,6 +205,9 @@ void StepDirTmcUART::updateStatus() {
       status.overTemperatureWarning = (bool)tmc2209Status.over_temperature_warning;
       status.overTemperature       = (bool)tmc2209Status.over_temperature_shutdown;
       status.standstill            = (bool)tmc2209Status.standstill;
+      status.load                  = driver->getStallGuardResult();
+      status.currentScale          = tmc2209Status.current_scaling;
+      status.loadValid             = true;
 
       // open load indication is not reliable in standstill
       if (
@@ -204,8 +216,6 @@ void StepDirTmcUART::updateStatus() {
         status.overTemperatureWarning ||
         status.overTemperature
       ) status.fault = true; else status.fault = false;
-
-      timeLastStatusUpdate = millis();
     }
   } else
   if (settings.status == LOW || settings.status == HIGH) {
@@ -218,10 +228,13 @@ void StepDirTmcUART::updateStatus() {
 // secondary way to power down not using the enable pin
 bool StepDirTmcUART::enable(bool state) {
   if (state) {
+    shadow.invalidate();
     modeDecayTracking();
   } else {
     driver->enableStealthChop();
     driver->setHoldCurrent(0);
+    shadow.invalidate(TSR_DECAY);
+    shadow.invalidate(TSR_CURRENT);
   }
 
   return true;
@@ -238,6 +251,7 @@ void StepDirTmcUART::calibrateDriver() {
     driver->setRunCurrent(settings.currentRun/25); // current in %
     driver->setHoldCurrent(settings.currentHold/25); // current in %
     driver->disableStealthChop();
+    shadow.invalidate();
   }
 }
 
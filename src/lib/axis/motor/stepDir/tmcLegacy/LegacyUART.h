@@ -8,6 +8,7 @@
 #if !defined(DRIVER_TMC_STEPPER) && defined(STEP_DIR_TMC_UART_PRESENT)
 
 #include "../StepDirDriver.h"
+#include "../../TmcShadow.h"
 
 // default settings for any TMC UART drivers that may be present
 #ifndef SERIAL_TMC
@@ -72,6 +73,8 @@ class StepDirTmcUART : public StepDirDriver {
     TMC2209Stepper *driver;
 
   private:
+    TmcShadow shadow;
+
     // checks if decay pin should be HIGH/LOW for a given decay setting
     int8_t getDecayPinState(int8_t decay);
 
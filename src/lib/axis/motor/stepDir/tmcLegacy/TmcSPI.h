@@ -89,6 +89,9 @@ class TmcSPI {
     inline bool set_COOLCONF_sgt(int v)          { if (v >= -64 && v <= 63)    { cl_sgt= v+64; return true; } return false; }
     inline bool set_COOLCONF_sfilt(int v)        { if (v >= 0 && v <= 1)       { cl_sfilt = v; return true; } return false; }
 
+    // forget what was last written so the next mode() writes every register
+    void invalidate();
+
   private:
     uint8_t write(byte Address, uint32_t data_out);
     uint8_t read(byte Address, uint32_t* data_out);
@@ -118,6 +121,7 @@ class TmcSPI {
     uint32_t last_TPOWERDOWN  = 0;
     uint32_t last_TPWMTHRS    = 0;
     uint32_t last_THIGH       = 0;
+    uint32_t last_CHOPCONF    = 0;
     uint32_t last_PWMCONF     = 0;
 
     // CHOPCONF settings
@@ -130,11 +130,12 @@ bool StepDirTmcSPI::validateParameters(float param1, float param2, float param3,
 }
 
 void StepDirTmcSPI::modeMicrostepTracking() {
+  if (!shadow.changed(TSR_MICROSTEPS, settings.microsteps)) return;
   if (settings.microsteps == 1) driver->microsteps(0); else driver->microsteps(settings.microsteps);
 }
 
 int StepDirTmcSPI::modeMicrostepSlewing() {
-  if (microstepRatio > 1) {
+  if (microstepRatio > 1 && shadow.changed(TSR_MICROSTEPS, settings.microstepsSlewing)) {
     if (settings.microstepsSlewing == 1) driver->microsteps(0); else driver->microsteps(settings.microstepsSlewing);
   }
   return microstepRatio;
@@ -142,19 +143,21 @@ int StepDirTmcSPI::modeMicrostepSlewing() {
 
 void StepDirTmcSPI::modeDecayTracking() {
   setDecayMode(settings.decay);
-  driver->rms_current(settings.currentRun*0.7071F, settings.currentHold/settings.currentRun);
+  if (shadow.changed(TSR_CURRENT, ((uint32_t)settings.currentRun << 16) | (uint16_t)settings.currentHold)) {
+    driver->rms_current(settings.currentRun*0.7071F, settings.currentHold/settings.currentRun);
+  }
 }
 
 void StepDirTmcSPI::modeDecaySlewing() {
   setDecayMode(settings.decaySlewing);
   int IGOTO = settings.currentGoto;
   if (IGOTO == OFF) IGOTO = settings.currentRun;
-  driver->rms_current(IGOTO*0.7071F, 1.0F);
+  if (shadow.changed(TSR_CURRENT, ((uint32_t)IGOTO << 16) | (uint16_t)IGOTO)) driver->rms_current(IGOTO*0.7071F, 1.0F);
 }
 
 void StepDirTmcSPI::updateStatus() {
   if (settings.status == ON) {
-    if ((long)(millis() - timeLastStatusUpdate) > 200) {
+    if (shadow.statusDue()) {
       uint32_t status_word;
       TMC2130_n::DRV_STATUS_t status_result;
       if (settings.model == TMC2130) { status_result.sr = ((TMC2130Stepper*)driver)->DRV_STATUS(); } else
@@ -167,12 +170,13 @@ void StepDirTmcSPI::updateStatus() {
       status.overTemperatureWarning= status_result.otpw;
       status.overTemperature       = status_result.ot;
       status.standstill            = status_result.stst;
+      status.load                  = status_result.sg_result;
+      status.currentScale          = status_result.cs_actual;
+      status.loadValid             = true;
 
       // open load indication is not reliable in standstill
       if (status.outputA.shortToGround || status.outputB.shortToGround ||
           status.overTemperatureWarning || status.overTemperature) status.fault = true; else status.fault = false;
-
-      timeLastStatusUpdate = millis();
     }
   } else
   if (settings.status == LOW || settings.status == HIGH) {
@@ -185,10 +189,12 @@ void StepDirTmcSPI::updateStatus() {
 // secondary way to power down not using the enable pin
 bool StepDirTmcSPI::enable(bool state) {
   if (state) {
+    shadow.invalidate();
     modeDecayTracking();
   } else {
     setDecayMode(STEALTHCHOP);
     driver->ihold(0);
+    shadow.invalidate(TSR_CURRENT);
   }
   return true;
 }
@@ -214,12 +220,14 @@ void StepDirTmcSPI::calibrateDriver() {
       ((TMC5161Stepper*)driver)->en_pwm_mode(true);
     }
     delay(1000);
+    shadow.invalidate();
     modeDecayTracking();
   }
 }
 
 // set the decay mode STEALTHCHOP or SPREADCYCLE
 void StepDirTmcSPI::setDecayMode(int decayMode) {
+  if (!shadow.changed(TSR_DECAY, decayMode != SPREADCYCLE)) return;
   if (settings.model == TMC2130) { ((TMC2130Stepper*)driver)->en_pwm_mode(decayMode != SPREADCYCLE); } else
   if (settings.model == TMC5160) { ((TMC5160Stepper*)driver)->en_pwm_mode(decayMode != SPREADCYCLE); } else
   if (settings.model == TMC5161) { ((TMC5161Stepper*)driver)->en_pwm_mode(decayMode != SPREADCYCLE); }
@@ -10,6 +10,7 @@
 #include <TMCStepper.h> // https://github.com/teemuatlut/TMCStepper
 
 #include "../../Drivers.h"
+#include "../../TmcShadow.h"
 #include "../StepDirDriver.h"
 
 #ifndef DRIVER_TMC_STEPPER_AUTOGRAD
@@ -54,6 +55,8 @@ class StepDirTmcSPI : public StepDirDriver {
     TMCStepper *driver;
 
   private:
+    TmcShadow shadow;
+
     // checks if decay pin should be HIGH/LOW for a given decay setting
     int8_t getDecayPinState(int8_t decay);
 
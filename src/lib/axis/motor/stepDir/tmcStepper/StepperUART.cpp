@@ -163,11 +163,12 @@ bool StepDirTmcUART::validateParameters(float param1, float param2, float param3
 }
 
 void StepDirTmcUART::modeMicrostepTracking() {
+  if (!shadow.changed(TSR_MICROSTEPS, settings.microsteps)) return;
   if (settings.microsteps == 1) driver->microsteps(0); else driver->microsteps(settings.microsteps);
 }
 
 int StepDirTmcUART::modeMicrostepSlewing() {
-  if (microstepRatio > 1) {
+  if (microstepRatio > 1 && shadow.changed(TSR_MICROSTEPS, settings.microstepsSlewing)) {
     if (settings.microstepsSlewing == 1) driver->microsteps(0); else driver->microsteps(settings.microstepsSlewing);
   }
   return microstepRatio;
@@ -175,18 +176,21 @@ int StepDirTmcUART::modeMicrostepSlewing() {
 
 void StepDirTmcUART::modeDecayTracking() {
   setDecayMode(settings.decay);
-  driver->rms_current(settings.currentRun*0.7071F, settings.currentHold/settings.currentRun);
+  if (shadow.changed(TSR_CURRENT, ((uint32_t)settings.currentRun << 16) | (uint16_t)settings.currentHold)) {
+    driver->rms_current(settings.currentRun*0.7071F, settings.currentHold/settings.currentRun);
+  }
 }
 
 void StepDirTmcUART::modeDecaySlewing() {
   setDecayMode(settings.decaySlewing);
   int IGOTO = settings.currentGoto;
   if (IGOTO == OFF) IGOTO = settings.currentRun;
-  driver->rms_current(IGOTO*0.7071F, 1.0F);
+  if (shadow.changed(TSR_CURRENT, ((uint32_t)IGOTO << 16) | (uint16_t)IGOTO)) driver->rms_current(IGOTO*0.7071F, 1.0F);
 }
 
 // set the decay mode STEALTHCHOP or SPREADCYCLE
 void StepDirTmcUART::setDecayMode(int decayMode) {
+  if (!shadow.changed(TSR_DECAY, decayMode == SPREADCYCLE)) return;
   if (settings.model == TMC2208) {
     ((TMC2208Stepper*)driver)->en_spreadCycle(decayMode == SPREADCYCLE);
   } else
@@ -197,7 +201,7 @@ void StepDirTmcUART::setDecayMode(int decayMode) {
 
 void StepDirTmcUART::updateStatus() {
   if (settings.status == ON) {
-    if ((long)(millis() - timeLastStatusUpdate) > 200) {
+    if (shadow.statusDue()) {
 
       TMC2208_n::DRV_STATUS_t status_result;
       if (settings.model == TMC2208) {
@@ -213,14 +217,17 @@ void StepDirTmcUART::updateStatus() {
       status.overTemperatureWarning = status_result.otpw;
       status.overTemperature       = status_result.ot;
       status.standstill            = status_result.stst;
+      status.currentScale          = status_result.cs_actual;
+      if (settings.model == TMC2209) {
+        status.load                = ((TMC2209Stepper*)driver)->SG_RESULT();
+        status.loadValid           = true;
+      }
 
       // open load indication is not reliable in standstill
       if (status.outputA.shortToGround ||
           status.outputB.shortToGround ||
           status.overTemperatureWarning ||
           status.overTemperature) status.fault = true; else status.fault = false;
-
-      timeLastStatusUpdate = millis();
     }
   } else
   if (settings.status == LOW || settings.status == HIGH) {
@@ -233,10 +240,12 @@ void StepDirTmcUART::updateStatus() {
 // secondary way to power down not using the enable pin
 bool StepDirTmcUART::enable(bool state) {
   if (state) {
+    shadow.invalidate();
     modeDecayTracking();
   } else {
     setDecayMode(STEALTHCHOP);
     driver->ihold(0);
+    shadow.invalidate(TSR_CURRENT);
   }
   return true;
 }
@@ -258,6 +267,7 @@ void StepDirTmcUART::calibrateDriver() {
       ((TMC2209Stepper*)driver)->en_spreadCycle(false);
     }
     delay(1000);
+    shadow.invalidate();
     modeDecayTracking();
   }
 }
@@ -10,6 +10,7 @@
 #include <TMCStepper.h> // https://github.com/teemuatlut/TMCStepper
 
 #include "../../Drivers.h"
+#include "../../TmcShadow.h"
 #include "../StepDirDriver.h"
 
 #ifndef DRIVER_TMC_STEPPER_AUTOGRAD
@@ -70,6 +71,8 @@ class StepDirTmcUART : public StepDirDriver {
     void calibrateDriver();
 
   private:
+    TmcShadow shadow;
+
     #if SERIAL_TMC == SoftSerial
       SoftwareSerial SerialTMC;
     #endif
@@ -98,3 +98,27 @@ bool Buffer::flush() {
   cb[0] = (char)0;
   return true;
 }
+
+void ReplyBuffer::set(const char *s) {
+  clear();
+  append(s);
+}
+
+void ReplyBuffer::append(char c) {
+  if (rbp >= bufferSize - 1) return;
+  rb[rbp++] = c;
+  rb[rbp] = 0;
+}
+
+void ReplyBuffer::append(const char *s) {
+  while (*s && rbp < bufferSize - 1) rb[rbp++] = *s++;
+  rb[rbp] = 0;
+}
+
+void ReplyBuffer::appendChecksum() {
+  const static char hex[] = "0123456789ABCDEF";
+  uint8_t cks = 0;
+  for (size_t i = 0; i < rbp; i++) cks += rb[i];
+  append(hex[cks >> 4]);
+  append(hex[cks & 0x0f]);
+}
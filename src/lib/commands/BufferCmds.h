@@ -2,6 +2,8 @@
 // Command processing
 #pragma once
 
+#include <Arduino.h>
+
 class Buffer {
   public:
     bool checksum = false;
@@ -28,3 +30,32 @@ class Buffer {
     int  cbp = 0;
     char seq = 0;
 };
+
+// append-only reply builder, the length is tracked so framing and checksums don't rescan the string
+class ReplyBuffer {
+  public:
+    const static int bufferSize = 80;
+
+    // the raw buffer, command handlers write their reply here
+    inline char* get() { return rb; }
+
+    // adopt the string written by a command handler
+    inline void set() { rb[bufferSize - 1] = 0; rbp = strlen(rb); }
+
+    // replace the contents
+    void set(const char *s);
+
+    void append(char c);
+    void append(const char *s);
+
+    // append the checksum of the current contents as two hex digits
+    void appendChecksum();
+
+    inline size_t length() { return rbp; }
+
+    inline void clear() { rbp = 0; rb[0] = 0; }
+
+  private:
+    char rb[bufferSize] = "";
+    size_t rbp = 0;
+};
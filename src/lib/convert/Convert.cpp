@@ -187,33 +187,45 @@ bool Convert::dmsToDouble(double *value, char *dms, bool signPresent) {
   return true;
 }
 
-void Convert::doubleToHms(char *reply, double value, bool signPresent, PrecisionMode p) {
-  char sign[2] = "";
-  double hour, minute, second, decimal = 0;
+// largest magnitude formatted, anything else (including NaN) is shown as zero
+#define CONVERT_FIXED_MAX 1000.0
+
+// write an unsigned integer with at least the given number of digits (zero padded)
+static char *appendUnsigned(char *p, uint32_t v, uint8_t width) {
+  char digits[10];
+  uint8_t n = 0;
+  do { digits[n++] = '0' + v % 10; v /= 10; } while (v > 0);
+  while (n < width) digits[n++] = '0';
+  while (n > 0) *p++ = digits[--n];
+  return p;
+}
 
-  // setup formatting, handle adding the sign
-  if (signPresent) {
-    if (value < 0) { value = -value; strcpy(sign,"-"); } else strcpy(sign,"+");
+void Convert::doubleToHms(char *reply, double value, bool signPresent, PrecisionMode p) {
+  char *s = reply;
+
+  // handle adding the sign, a negative value always gets one rather than wrapping when made unsigned
+  if (value < 0) { value = -value; *s++ = '-'; } else if (signPresent) *s++ = '+';
+  if (!(value < CONVERT_FIXED_MAX)) value = 0.0;
+
+  // scale to fixed point, 0.0001 second or 1 second units (rounded) depending on precision mode
+  uint32_t scale = (p == PM_HIGHEST) ? 10000UL : 1UL;
+  uint32_t hour = (uint32_t)value;
+  uint32_t units = (uint32_t)((value - hour)*3600.0*scale + 0.5);
+  if (units >= 3600UL*scale) { units -= 3600UL*scale; hour++; }
+
+  uint32_t decimal = units % scale; units /= scale;
+  uint32_t second = units % 60;
+  uint32_t minute = units / 60;
+
+  // form the result string, HH:MM, HH:MM.M, HH:MM:SS, or HH:MM:SS.SSSS
+  s = appendUnsigned(s, hour, 2); *s++ = ':';
+  s = appendUnsigned(s, minute, 2);
+  if (p == PM_LOW) { *s++ = '.'; s = appendUnsigned(s, second/6, 1); } else
+  if (p != PM_LOWEST) {
+    *s++ = ':'; s = appendUnsigned(s, second, 2);
+    if (p == PM_HIGHEST) { *s++ = '.'; s = appendUnsigned(s, decimal, 4); }
   }
-  
-  // round to 0.00005 second or 0.5 second, depending on precision mode
-  if (p == PM_HIGHEST) value += 0.0000000139; else value += 0.000139;
-
-  hour = floor(value);
-  minute = (value - hour)*60.0;
-  second = (minute - floor(minute))*60.0;
-
-  // finish off calculations for hms and form string template
-  char form[]="%s%02d:%02d:%02d.%04d";
-  if (p == PM_HIGHEST) { decimal = (second - floor(second))*10000.0; } else
-  if (p == PM_HIGH)    { form[16] = 0; } else
-  if (p == PM_LOW)     { form[16] = 0; form[11] = '.'; form[14] = '1'; second = second/6.0; } else
-  if (p == PM_LOWEST)  { form[11] = 0; second = 0; }
-
-  // set sign and return result string
-  if (p == PM_HIGHEST) sprintf(reply, form, sign, (int)hour, (int)minute, (int)second, (int)decimal); else
-  if (p == PM_LOWEST)  sprintf(reply, form, sign, (int)hour, (int)minute); else
-                       sprintf(reply, form, sign, (int)hour, (int)minute, (int)second);
+  *s = 0;
 }
 
 // convert double (in degrees) to string in format as follows:
@@ -224,31 +236,30 @@ void Convert::doubleToHms(char *reply, double value, bool signPresent, Precision
 // DDD:MM:SS       PM_HIGH
 // sDD:MM:SS.SSS   PM_HIGHEST
 void Convert::doubleToDms(char *reply, double value, bool fullRange, bool signPresent, PrecisionMode p) {
-  char sign[2] = "";
-  double deg, minute, second = 0, decimal = 0;
-
-  // setup formatting, handle adding the sign
-  if (signPresent) {
-    if (value < 0) { value = -value; strcpy(sign,"-"); } else strcpy(sign,"+");
+  char *s = reply;
+
+  // handle adding the sign, a negative value always gets one rather than wrapping when made unsigned
+  if (value < 0) { value = -value; *s++ = '-'; } else if (signPresent) *s++ = '+';
+  if (!(value < CONVERT_FIXED_MAX)) value = 0.0;
+
+  // scale to fixed point, 0.001 arc-second or 1 arc-second units (rounded) depending on precision mode
+  uint32_t scale = (p == PM_HIGHEST) ? 1000UL : 1UL;
+  uint32_t deg = (uint32_t)value;
+  uint32_t units = (uint32_t)((value - deg)*3600.0*scale + 0.5);
+  if (units >= 3600UL*scale) { units -= 3600UL*scale; deg++; }
+
+  uint32_t decimal = units % scale; units /= scale;
+  uint32_t second = units % 60;
+  uint32_t minute = units / 60;
+
+  // form the result string, DD*MM, DD*MM:SS, or DD*MM:SS.SSS
+  s = appendUnsigned(s, deg, fullRange ? 3 : 2); *s++ = '*';
+  s = appendUnsigned(s, minute, 2);
+  if (p == PM_HIGH || p == PM_HIGHEST) {
+    *s++ = ':'; s = appendUnsigned(s, second, 2);
+    if (p == PM_HIGHEST) { *s++ = '.'; s = appendUnsigned(s, decimal, 3); }
   }
-
-  // round to 0.0005 arc-second or 0.5 arc-second, depending on precision mode
-  if (p == PM_HIGHEST) value += 0.000000139; else value += 0.000139; 
-
-  deg = floor(value);
-  minute = (value - deg)*60.0;
-  second = (minute - floor(minute))*60.0;
-
-  // finish off calculations for dms and form string template
-  char form[]="%s%02d*%02d:%02d.%03d";
-  if (p != PM_HIGHEST) form[16] = 0; else decimal = (second - floor(second))*1000.0;
-  if (p == PM_LOW)     form[11] = 0;
-  if (fullRange)                   form[4]  = '3';
- 
-  // return result string
-  if (p == PM_HIGHEST) sprintf(reply, form, sign, (int)deg, (int)minute, (int)second, (int)decimal); else
-  if (p == PM_HIGH)    sprintf(reply, form, sign, (int)deg, (int)minute, (int)second); else
-  if (p == PM_LOW)     sprintf(reply, form, sign, (int)deg, (int)minute);
+  *s = 0;
 }
 
 bool Convert::atoi2(char *a, int16_t *i, bool sign) {
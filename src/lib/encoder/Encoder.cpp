@@ -6,7 +6,54 @@
 void Encoder::init() {
 }
 
+// start any background processing
+void Encoder::start() {
+}
+
 // set encoder origin
 void Encoder::setOrigin(uint32_t count) {
   origin = count;
 }
+
+// get the position between counts and velocity at this time from the recent edge times
+bool Encoder::readInterpolated(unsigned long timeMicros, float *fraction, float *velocity) {
+  if (!recordsEdges) return false;
+
+  *fraction = 0.0F;
+  *velocity = 0.0F;
+
+  // the latest edge and how far back edges continue in the same direction
+  noInterrupts();
+  uint8_t count = edgeCount;
+  uint8_t head = edgeHead;
+  uint32_t lastTime = edgeTime[head];
+  int8_t dir = edgeDir[head];
+  uint32_t firstTime = lastTime;
+  uint8_t edges = 0;
+  for (uint8_t i = 1; i < count; i++) {
+    uint8_t index = (head - i) & (ENCODER_EDGE_HISTORY - 1);
+    if (edgeDir[index] != dir) break;
+    firstTime = edgeTime[index];
+    edges = i;
+  }
+  interrupts();
+
+  if (count == 0 || dir == 0) return true;
+
+  long sinceLastEdge = (long)(timeMicros - lastTime);
+  if (sinceLastEdge < 0) sinceLastEdge = 0;
+
+  float v = 0.0F;
+  if (edges > 0 && lastTime != firstTime) v = (dir*edges*1000000.0F)/(lastTime - firstTime);
+
+  // if the next edge is overdue we've slowed to at most one count over the time since the last edge
+  if (sinceLastEdge > 0 && fabs(v)*sinceLastEdge > 1000000.0F) v = (dir*1000000.0F)/sinceLastEdge;
+  *velocity = v;
+
+  // the count changed as the position crossed into it, half a count behind the center
+  float f = -0.5F*dir + v*(sinceLastEdge/1000000.0F);
+  if (f > 0.5F) f = 0.5F; else if (f < -0.5F) f = -0.5F;
+  *fraction = f;
+
+  return true;
+}
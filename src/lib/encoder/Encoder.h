@@ -47,11 +47,18 @@
   #define HAS_BISS_C
 #endif
 
+#ifndef ENCODER_EDGE_HISTORY
+  #define ENCODER_EDGE_HISTORY 8 // number of edge times kept for interpolation, must be a power of two
+#endif
+
 class Encoder {
   public:
     // get device ready for use
     virtual void init();
 
+    // start any background processing, once the task scheduler is running
+    virtual void start();
+
     // set encoder origin
     virtual void setOrigin(uint32_t count);
 
@@ -61,6 +68,18 @@ class Encoder {
     // set current position to value
     virtual void write(int32_t count);
 
+    // get the position between counts (-0.5 to 0.5 about the count read) and velocity in counts per second
+    // at this time from the recent edge times, returns false if the encoder doesn't record edges
+    virtual bool readInterpolated(unsigned long timeMicros, float *fraction, float *velocity);
+
+    // record the time and direction of an edge, for use in the ISR's
+    inline void edge(int8_t dir) {
+      edgeHead = (edgeHead + 1) & (ENCODER_EDGE_HISTORY - 1);
+      edgeTime[edgeHead] = micros();
+      edgeDir[edgeHead] = dir;
+      if (edgeCount < ENCODER_EDGE_HISTORY) edgeCount++;
+    }
+
     // true if encoder count is ready
     bool ready = true;
 
@@ -79,6 +98,15 @@ class Encoder {
     int32_t count = 0;
 
   protected:
+    // clear the edge history (when the count is written)
+    inline void edgeReset() { noInterrupts(); edgeCount = 0; interrupts(); }
+
+    bool recordsEdges = false;
+    volatile uint32_t edgeTime[ENCODER_EDGE_HISTORY];
+    volatile int8_t edgeDir[ENCODER_EDGE_HISTORY];
+    volatile uint8_t edgeHead = 0;
+    volatile uint8_t edgeCount = 0;
+
     bool initialized = false;
 
     int16_t axis = 0;
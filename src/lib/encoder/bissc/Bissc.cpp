@@ -4,6 +4,16 @@
 
 #ifdef HAS_BISS_C
 
+#include "../../tasks/OnTask.h"
+
+Bissc *bisscInstance[9];
+uint8_t bisscTaskHandle = 0;
+
+// one task reads frames for all BiSS-C encoders so the servo loop only picks up the cached count
+void bisscPoll() {
+  for (int i = 0; i < 9; i++) if (bisscInstance[i] != NULL) bisscInstance[i]->poll();
+}
+
 // get device ready for use
 void Bissc::init() {
   if (initialized) { VF("WRN: Encoder BiSS-C"); V(axis); VLF(" init(), already initialized!"); return; }
@@ -15,6 +25,37 @@ void Bissc::init() {
   initialized = true;
 }
 
+// start reading frames in the background
+void Bissc::start() {
+  if (!initialized) { VF("WRN: Encoder BiSS-C"); V(axis); VLF(" start(), not initialized!"); return; }
+  if (axis < 1 || axis > 9 || polling) return;
+
+  bisscInstance[axis - 1] = this;
+
+  if (bisscTaskHandle == 0) {
+    VF("MSG: Encoder BiSS-C, start read task (rate "); V(BISSC_READ_PERIOD_US); VF("us priority 1)... ");
+    bisscTaskHandle = tasks.add(0, 0, true, 1, bisscPoll, "BissC");
+    if (bisscTaskHandle) {
+      tasks.setPeriodMicros(bisscTaskHandle, BISSC_READ_PERIOD_US);
+      VLF("success");
+    } else { VLF("FAILED!"); return; }
+  }
+
+  polling = true;
+}
+
+// read a frame and cache the result
+void Bissc::poll() {
+  unsigned long now = micros();
+  uint32_t temp = 0;
+  if (readEnc(temp)) {
+    lastValidPosition = temp;
+    lastValidTime = millis();
+    captureTime = now;
+    frameValid = true;
+  } else frameValid = false;
+}
+
 // set encoder origin
 void Bissc::setOrigin(uint32_t count) {
   if (!initialized) { VF("WRN: Encoder BiSS-C"); V(axis); VLF(" setOrigin(), not initialized!"); return; }
@@ -58,10 +99,18 @@ void Bissc::write(int32_t count) {
 
 // read encoder count with (1 second) error recovery
 bool Bissc::readEncLatest(uint32_t &position) {
+  // once polling use the latest count from the background task
+  if (polling) {
+    if ((long)(millis() - lastValidTime) > 1000) return false;
+    position = lastValidPosition;
+    return true;
+  }
+
   uint32_t temp = position;
   bool success = readEnc(temp);
   if (success) {
     lastValidTime = millis();
+    captureTime = micros();
     lastValidPosition = temp;
     position = temp;
     return true;
@@ -12,6 +12,11 @@
     #define BISSC_CLOCK_RATE_KHZ 4000
   #endif
 
+  // frames are read in the background at this period and read() returns the latest valid count
+  #ifndef BISSC_READ_PERIOD_US
+    #define BISSC_READ_PERIOD_US 1000
+  #endif
+
   // default to single turn mode
   #ifndef BISSC_SINGLE
     #define BISSC_SINGLE_TURN ON
@@ -22,6 +27,9 @@
       // get device ready for use
       void init();
 
+      // start reading frames in the background
+      void start();
+
       // set encoder origin
       void setOrigin(uint32_t count);
 
@@ -31,6 +39,15 @@
       // write encoder position
       void write(int32_t count);
 
+      // read a frame and cache the result, called from the background task
+      void poll();
+
+      // time the latest valid count was captured (in microseconds)
+      inline unsigned long getCaptureTime() { return captureTime; }
+
+      // true if the most recent frame passed the CRC and status checks
+      inline bool isFrameValid() { return frameValid; }
+
     protected:
       // read encoder position with error recovery
       bool readEncLatest(uint32_t &position);
@@ -48,6 +65,10 @@
 
       uint32_t lastValidTime = 0;
       uint32_t lastValidPosition = 0;
+
+      bool polling = false;
+      volatile bool frameValid = false;
+      volatile unsigned long captureTime = 0;
   };
 
 #endif
@@ -7,50 +7,51 @@
     AXIS7_ENCODER == CW_CCW || AXIS8_ENCODER == CW_CCW || AXIS9_ENCODER == CW_CCW
 
 volatile int32_t _cw_ccw_count[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+CwCcw *cwCcwInstance[9];
 
 #if AXIS1_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis1() { _cw_ccw_count[0]++; }
-  IRAM_ATTR void cwCcw_B_Axis1() { _cw_ccw_count[0]--; }
+  IRAM_ATTR void cwCcw_A_Axis1() { _cw_ccw_count[0]++; cwCcwInstance[0]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis1() { _cw_ccw_count[0]--; cwCcwInstance[0]->edge(-1); }
 #endif
 
 #if AXIS2_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis2() { _cw_ccw_count[1]++; }
-  IRAM_ATTR void cwCcw_B_Axis2() { _cw_ccw_count[1]--; }
+  IRAM_ATTR void cwCcw_A_Axis2() { _cw_ccw_count[1]++; cwCcwInstance[1]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis2() { _cw_ccw_count[1]--; cwCcwInstance[1]->edge(-1); }
 #endif
 
 #if AXIS3_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis3() { _cw_ccw_count[2]++; }
-  IRAM_ATTR void cwCcw_B_Axis3() { _cw_ccw_count[2]--;}
+  IRAM_ATTR void cwCcw_A_Axis3() { _cw_ccw_count[2]++; cwCcwInstance[2]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis3() { _cw_ccw_count[2]--; cwCcwInstance[2]->edge(-1); }
 #endif
 
 #if AXIS4_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis4() { _cw_ccw_count[3]++; }
-  IRAM_ATTR void cwCcw_B_Axis4() { _cw_ccw_count[3]--; }
+  IRAM_ATTR void cwCcw_A_Axis4() { _cw_ccw_count[3]++; cwCcwInstance[3]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis4() { _cw_ccw_count[3]--; cwCcwInstance[3]->edge(-1); }
 #endif
 
 #if AXIS5_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis5() { _cw_ccw_count[4]++; }
-  IRAM_ATTR void cwCcw_B_Axis5() { _cw_ccw_count[4]--; }
+  IRAM_ATTR void cwCcw_A_Axis5() { _cw_ccw_count[4]++; cwCcwInstance[4]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis5() { _cw_ccw_count[4]--; cwCcwInstance[4]->edge(-1); }
 #endif
 
 #if AXIS6_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis6() { _cw_ccw_count[5]++; }
-  IRAM_ATTR void cwCcw_B_Axis6() { _cw_ccw_count[5]--; }
+  IRAM_ATTR void cwCcw_A_Axis6() { _cw_ccw_count[5]++; cwCcwInstance[5]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis6() { _cw_ccw_count[5]--; cwCcwInstance[5]->edge(-1); }
 #endif
 
 #if AXIS7_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis7() { _cw_ccw_count[6]++; }
-  IRAM_ATTR void cwCcw_B_Axis7() { _cw_ccw_count[6]--; }
+  IRAM_ATTR void cwCcw_A_Axis7() { _cw_ccw_count[6]++; cwCcwInstance[6]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis7() { _cw_ccw_count[6]--; cwCcwInstance[6]->edge(-1); }
 #endif
 
 #if AXIS8_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis8() { _cw_ccw_count[7]++; }
-  IRAM_ATTR void cwCcw_B_Axis8() { _cw_ccw_count[7]--; }
+  IRAM_ATTR void cwCcw_A_Axis8() { _cw_ccw_count[7]++; cwCcwInstance[7]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis8() { _cw_ccw_count[7]--; cwCcwInstance[7]->edge(-1); }
 #endif
 
 #if AXIS9_ENCODER == CW_CCW
-  IRAM_ATTR void cwCcw_A_Axis9() { _cw_ccw_count[8]++; }
-  IRAM_ATTR void cwCcw_B_Axis9() { _cw_ccw_count[8]--; }
+  IRAM_ATTR void cwCcw_A_Axis9() { _cw_ccw_count[8]++; cwCcwInstance[8]->edge(1); }
+  IRAM_ATTR void cwCcw_B_Axis9() { _cw_ccw_count[8]--; cwCcwInstance[8]->edge(-1); }
 #endif
 
 CwCcw::CwCcw(int16_t cwPin, int16_t ccwPin, int16_t axis) {
@@ -59,9 +60,11 @@ CwCcw::CwCcw(int16_t cwPin, int16_t ccwPin, int16_t axis) {
   this->cwPin = cwPin;
   this->ccwPin = ccwPin;
   this->axis = axis - 1;
+  cwCcwInstance[this->axis] = this;
+  recordsEdges = true;
 }
 
-void CwCCW::init() {
+void CwCcw::init() {
   if (initialized) { VF("WRN: Encoder CwCcw"); V(axis); VLF(" init(), already initialized!"); return; }
 
   pinMode(cwPin, INPUT_PULLUP);
@@ -143,6 +146,7 @@ void CwCcw::write(int32_t count) {
   noInterrupts();
   _cw_ccw_count[axis] = count;
   interrupts();
+  edgeReset();
 }
 
 #endif
@@ -7,41 +7,42 @@
     AXIS7_ENCODER == PULSE_DIR || AXIS8_ENCODER == PULSE_DIR || AXIS9_ENCODER == PULSE_DIR
 
 volatile int32_t _pulse_dir_count[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+PulseDir *pulseDirInstance[9];
 
 #if AXIS1_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis1() { if (digitalReadF(AXIS1_ENCODER_B_PIN)) _pulse_dir_count[0]--; else _pulse_dir_count[0]++; }
+  IRAM_ATTR void pulseDir_A_Axis1() { if (digitalReadF(AXIS1_ENCODER_B_PIN)) { _pulse_dir_count[0]--; pulseDirInstance[0]->edge(-1); } else { _pulse_dir_count[0]++; pulseDirInstance[0]->edge(1); } }
 #endif
 
 #if AXIS2_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis2() { if (digitalReadF(AXIS2_ENCODER_B_PIN)) _pulse_dir_count[1]--; else _pulse_dir_count[1]++; }
+  IRAM_ATTR void pulseDir_A_Axis2() { if (digitalReadF(AXIS2_ENCODER_B_PIN)) { _pulse_dir_count[1]--; pulseDirInstance[1]->edge(-1); } else { _pulse_dir_count[1]++; pulseDirInstance[1]->edge(1); } }
 #endif
 
 #if AXIS3_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis3() { if (digitalReadF(AXIS3_ENCODER_B_PIN)) _pulse_dir_count[2]--; else _pulse_dir_count[2]++; }
+  IRAM_ATTR void pulseDir_A_Axis3() { if (digitalReadF(AXIS3_ENCODER_B_PIN)) { _pulse_dir_count[2]--; pulseDirInstance[2]->edge(-1); } else { _pulse_dir_count[2]++; pulseDirInstance[2]->edge(1); } }
 #endif
 
 #if AXIS4_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis4() { if (digitalReadF(AXIS4_ENCODER_B_PIN)) _pulse_dir_count[3]--; else _pulse_dir_count[3]++; }
+  IRAM_ATTR void pulseDir_A_Axis4() { if (digitalReadF(AXIS4_ENCODER_B_PIN)) { _pulse_dir_count[3]--; pulseDirInstance[3]->edge(-1); } else { _pulse_dir_count[3]++; pulseDirInstance[3]->edge(1); } }
 #endif
 
 #if AXIS5_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis5() { if (digitalReadF(AXIS5_ENCODER_B_PIN)) _pulse_dir_count[4]--; else _pulse_dir_count[4]++; }
+  IRAM_ATTR void pulseDir_A_Axis5() { if (digitalReadF(AXIS5_ENCODER_B_PIN)) { _pulse_dir_count[4]--; pulseDirInstance[4]->edge(-1); } else { _pulse_dir_count[4]++; pulseDirInstance[4]->edge(1); } }
 #endif
 
 #if AXIS6_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis6() { if (digitalReadF(AXIS6_ENCODER_B_PIN)) _pulse_dir_count[5]--; else _pulse_dir_count[5]++; }
+  IRAM_ATTR void pulseDir_A_Axis6() { if (digitalReadF(AXIS6_ENCODER_B_PIN)) { _pulse_dir_count[5]--; pulseDirInstance[5]->edge(-1); } else { _pulse_dir_count[5]++; pulseDirInstance[5]->edge(1); } }
 #endif
 
 #if AXIS7_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis7() { if (digitalReadF(AXIS7_ENCODER_B_PIN)) _pulse_dir_count[6]--; else _pulse_dir_count[6]++; }
+  IRAM_ATTR void pulseDir_A_Axis7() { if (digitalReadF(AXIS7_ENCODER_B_PIN)) { _pulse_dir_count[6]--; pulseDirInstance[6]->edge(-1); } else { _pulse_dir_count[6]++; pulseDirInstance[6]->edge(1); } }
 #endif
 
 #if AXIS8_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis8() { if (digitalReadF(AXIS8_ENCODER_B_PIN)) _pulse_dir_count[7]--; else _pulse_dir_count[7]++; }
+  IRAM_ATTR void pulseDir_A_Axis8() { if (digitalReadF(AXIS8_ENCODER_B_PIN)) { _pulse_dir_count[7]--; pulseDirInstance[7]->edge(-1); } else { _pulse_dir_count[7]++; pulseDirInstance[7]->edge(1); } }
 #endif
 
 #if AXIS9_ENCODER == PULSE_DIR
-  IRAM_ATTR void pulseDir_A_Axis9() { if (digitalReadF(AXIS9_ENCODER_B_PIN)) _pulse_dir_count[8]--; else _pulse_dir_count[8]++; }
+  IRAM_ATTR void pulseDir_A_Axis9() { if (digitalReadF(AXIS9_ENCODER_B_PIN)) { _pulse_dir_count[8]--; pulseDirInstance[8]->edge(-1); } else { _pulse_dir_count[8]++; pulseDirInstance[8]->edge(1); } }
 #endif
 
 PulseDir::PulseDir(int16_t pulsePin, int16_t dirPin, int16_t axis) {
@@ -50,6 +51,8 @@ PulseDir::PulseDir(int16_t pulsePin, int16_t dirPin, int16_t axis) {
   this->pulsePin = pulsePin;
   this->dirPin = dirPin;
   this->axis = axis - 1;
+  pulseDirInstance[this->axis] = this;
+  recordsEdges = true;
 }
 
 void PulseDir::init() {
@@ -124,6 +127,7 @@ void PulseDir::write(int32_t count) {
   noInterrupts();
   _pulse_dir_count[axis] = count;
   interrupts();
+  edgeReset();
 }
 
 #endif
@@ -63,6 +63,7 @@ Quadrature::Quadrature(int16_t APin, int16_t BPin, int16_t axis) {
   this->BPin = BPin;
   this->axis = axis;
   quadratureInstance[this->axis - 1] = this;
+  recordsEdges = true;
 }
 
 void Quadrature::init() {
@@ -155,6 +156,7 @@ void Quadrature::write(int32_t count) {
   noInterrupts();
   this->count = count;
   interrupts();
+  edgeReset();
 }
 
 // Phase 1: LLHH LLHH
@@ -185,6 +187,7 @@ ICACHE_RAM_ATTR void Quadrature::A(const int16_t pin) {
     case 0b1111: dir = 0; error = true; break; // skipped pulse use last dir (way too fast if this is happening)
   }
   count += dir;
+  if (dir != 0) edge(dir);
   
   lastA = stateA;
   lastB = stateB;
@@ -214,6 +217,7 @@ ICACHE_RAM_ATTR void Quadrature::B(const int16_t pin) {
     case 0b1111: dir = 0; error = true; break;
   }
   count += dir;
+  if (dir != 0) edge(dir);
   
   lastA = stateA;
   lastB = stateB;
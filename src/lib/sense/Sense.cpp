@@ -10,6 +10,21 @@
   #define ANALOG_READ_RANGE 1023
 #endif
 
+#if SENSE_INTERRUPT == ON
+  SenseInput *senseIsrInput[SENSE_ISR_MAX];
+
+  IRAM_ATTR void senseIsr0() { senseIsrInput[0]->isr(); }
+  IRAM_ATTR void senseIsr1() { senseIsrInput[1]->isr(); }
+  IRAM_ATTR void senseIsr2() { senseIsrInput[2]->isr(); }
+  IRAM_ATTR void senseIsr3() { senseIsrInput[3]->isr(); }
+  IRAM_ATTR void senseIsr4() { senseIsrInput[4]->isr(); }
+  IRAM_ATTR void senseIsr5() { senseIsrInput[5]->isr(); }
+  IRAM_ATTR void senseIsr6() { senseIsrInput[6]->isr(); }
+  IRAM_ATTR void senseIsr7() { senseIsrInput[7]->isr(); }
+
+  void (*senseIsr[SENSE_ISR_MAX])() = { senseIsr0, senseIsr1, senseIsr2, senseIsr3, senseIsr4, senseIsr5, senseIsr6, senseIsr7 };
+#endif
+
 SenseInput::SenseInput(int pin, int initState, int32_t trigger) {
   this->pin = pin;
 
@@ -49,6 +64,13 @@ SenseInput::SenseInput(int pin, int initState, int32_t trigger) {
 
 int SenseInput::isOn() {
   int value = lastValue;
+  #if SENSE_INTERRUPT == ON
+    if (interruptDriven) {
+      noInterrupts();
+      value = settle(micros());
+      interrupts();
+    } else
+  #endif
   if (isAnalog) {
     int sample = analogRead(pin);
     if (sample >= threshold + hysteresis) value = HIGH;
@@ -65,6 +87,13 @@ int SenseInput::isOn() {
 
 int SenseInput::changed() {
   int value = lastChangedValue;
+  #if SENSE_INTERRUPT == ON
+    if (interruptDriven) {
+      noInterrupts();
+      value = settle(micros());
+      interrupts();
+    } else
+  #endif
   if (isAnalog) {
     int sample = analogRead(pin);
     if (sample >= threshold + hysteresis) value = HIGH;
@@ -82,6 +111,9 @@ int SenseInput::changed() {
 
 void SenseInput::poll() {
   int value = lastValue;
+  #if SENSE_INTERRUPT == ON
+    if (interruptDriven) return;
+  #endif
   if (!isAnalog) {
     int sample = digitalReadEx(pin);
     if (stableSample != sample) { stableStartMs = millis(); stableSample = sample; }
@@ -96,6 +128,89 @@ void SenseInput::reset() {
   stableSample = lastValue;
 }
 
+#if SENSE_INTERRUPT == ON
+  // true if this input's pin can be interrupt driven
+  bool SenseInput::interruptCapable() {
+    if (isAnalog || pin < 0 || pin >= 0x100) return false;
+    #ifdef NOT_AN_INTERRUPT
+      if (digitalPinToInterrupt(CLEAN_PIN(pin)) == NOT_AN_INTERRUPT) return false;
+    #endif
+    return true;
+  }
+
+  // attach the pin change interrupt
+  void SenseInput::attach(void (*isr)()) {
+    debounceUs = hysteresis*1000UL;
+    isrValue = lastValue;
+    isrCandidate = lastValue;
+    isrBouncing = false;
+    interruptDriven = true;
+    if (isr != NULL) attachInterrupt(digitalPinToInterrupt(CLEAN_PIN(pin)), isr, CHANGE);
+  }
+
+  // have another input on the same pin handled by this input's interrupt
+  void SenseInput::share(SenseInput *input) {
+    SenseInput *last = this;
+    while (last->nextOnPin != NULL) last = last->nextOnPin;
+    noInterrupts();
+    input->attach(NULL);
+    last->nextOnPin = input;
+    interrupts();
+  }
+
+  // handle a pin change interrupt for this input and any others on the same pin
+  IRAM_ATTR void SenseInput::isr() {
+    capture();
+    if (nextOnPin != NULL) nextOnPin->isr();
+  }
+
+  // capture a pin change, the first transition away from the debounced state starts the
+  // edge and it's accepted once the pin has been stable in the new state for the debounce time
+  IRAM_ATTR void SenseInput::capture() {
+    unsigned long t = micros();
+    long count = (latchSource != NULL) ? *latchSource : 0;
+    int sample = digitalReadF(CLEAN_PIN(pin));
+
+    settle(t);
+    if (!isrBouncing) {
+      if (sample == isrValue) return;
+      isrBouncing = true;
+      isrFirstEdgeUs = t;
+      isrFirstEdgeCount = count;
+    }
+    isrCandidate = sample;
+    isrLastEdgeUs = t;
+  }
+
+  // the debounced state once the state being debounced has been stable long enough, interrupts must be disabled
+  IRAM_ATTR int SenseInput::settle(unsigned long timeUs) {
+    if (isrBouncing && timeUs - isrLastEdgeUs >= debounceUs) {
+      isrBouncing = false;
+      if (isrCandidate != isrValue) {
+        isrValue = isrCandidate;
+        int index = (isrValue == activeState) ? 1 : 0;
+        edges[index].timeUs = isrFirstEdgeUs;
+        edges[index].count = isrFirstEdgeCount;
+        edges[index].ready = true;
+      }
+    }
+    return isrValue;
+  }
+
+  // get the last edge into the active (on = true) or inactive state
+  bool SenseInput::edge(bool on, unsigned long *timeUs, long *count) {
+    int index = on ? 1 : 0;
+    noInterrupts();
+    settle(micros());
+    bool ready = edges[index].ready;
+    *timeUs = edges[index].timeUs;
+    *count = edges[index].count;
+    edges[index].ready = false;
+    interrupts();
+    return ready;
+  }
+#endif
+
 // Manage sense pins
 
 uint8_t Sense::add(int pin, int initState, int32_t trigger, bool force) {
@@ -108,6 +223,23 @@ uint8_t Sense::add(int pin, int initState, int32_t trigger, bool force) {
   }
   VF("MSG: Sense"); V(senseCount); V(", init ");
   senseInput[senseCount] = new SenseInput(pin, initState, trigger);
+  #if SENSE_INTERRUPT == ON
+    if (senseInput[senseCount]->interruptCapable()) {
+      // a pin has only one ISR, inputs on a pin that already has one share it
+      SenseInput *shared = NULL;
+      for (int i = 0; i < isrCount; i++) if (senseIsrInput[i]->getPin() == pin) { shared = senseIsrInput[i]; break; }
+      if (shared != NULL) {
+        VF("MSG: Sense"); V(senseCount); VLF(", sharing ISR");
+        shared->share(senseInput[senseCount]);
+      } else
+      if (isrCount < SENSE_ISR_MAX) {
+        VF("MSG: Sense"); V(senseCount); VLF(", attaching ISR");
+        senseIsrInput[isrCount] = senseInput[senseCount];
+        senseInput[senseCount]->attach(senseIsr[isrCount]);
+        isrCount++;
+      }
+    }
+  #endif
   senseCount++;
   return senseCount;
 }
@@ -122,6 +254,36 @@ int Sense::changed(uint8_t handle) {
   return senseInput[handle - 1]->changed();
 }
 
+void Sense::setLatch(uint8_t handle, volatile long *source) {
+  if (handle == 0) return;
+  #if SENSE_INTERRUPT == ON
+    noInterrupts();
+    senseInput[handle - 1]->latchSource = source;
+    interrupts();
+  #else
+    UNUSED(source);
+  #endif
+}
+
+bool Sense::edge(uint8_t handle, bool on, unsigned long *timeUs, long *count) {
+  if (handle == 0) return false;
+  #if SENSE_INTERRUPT == ON
+    if (senseInput[handle - 1]->interruptDriven) return senseInput[handle - 1]->edge(on, timeUs, count);
+  #else
+    UNUSED(on); UNUSED(timeUs); UNUSED(count);
+  #endif
+  return false;
+}
+
+bool Sense::isInterruptDriven(uint8_t handle) {
+  if (handle == 0) return false;
+  #if SENSE_INTERRUPT == ON
+    return senseInput[handle - 1]->interruptDriven;
+  #else
+    return false;
+  #endif
+}
+
 void Sense::poll() {
   for (int i = 0; i < senseCount; i++) { senseInput[i]->poll(); Y; }
 }
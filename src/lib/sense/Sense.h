@@ -24,6 +24,22 @@
 // largest possible trigger value == 2^21
 #define SENSE_MAX_TRIGGER 2097152
 
+// digital sense inputs can be interrupt driven, edges are then timestamped and debounced in the ISR
+// so none are missed between reads and each read is just a copy of the debounced state:
+// #define SENSE_INTERRUPT ON
+#ifndef SENSE_INTERRUPT
+  #define SENSE_INTERRUPT OFF
+#endif
+
+// sense inputs that can be interrupt driven, any others are read as usual
+#define SENSE_ISR_MAX 8
+
+typedef struct SenseEdge {
+  bool ready;                 // an edge was seen since last collected
+  unsigned long timeUs;       // when the first transition of the edge happened
+  long count;                 // the latch source value at that time
+} SenseEdge;
+
 class SenseInput {
   public:
     SenseInput(int pin, int initState, int32_t trigger);
@@ -33,9 +49,53 @@ class SenseInput {
 
     void poll();
 
+    #if SENSE_INTERRUPT == ON
+      // true if this input's pin can be interrupt driven
+      bool interruptCapable();
+
+      // attach the pin change interrupt
+      void attach(void (*isr)());
+
+      // have another input on the same pin handled by this input's interrupt
+      void share(SenseInput *input);
+
+      inline int getPin() { return pin; }
+
+      // handle a pin change interrupt
+      void isr();
+
+      // get the last edge into the active (on = true) or inactive state
+      bool edge(bool on, unsigned long *timeUs, long *count);
+
+      // value latched at each edge
+      volatile long *latchSource = NULL;
+
+      bool interruptDriven = false;
+    #endif
+
   private:
     void reset();
 
+    #if SENSE_INTERRUPT == ON
+      // the debounced state once the state being debounced has been stable long enough
+      int settle(unsigned long timeUs);
+
+      // capture a pin change for this input
+      void capture();
+
+      // the next input sharing this pin's interrupt
+      SenseInput *nextOnPin = NULL;
+
+      unsigned long debounceUs = 0;
+      volatile int isrValue = LOW;
+      volatile int isrCandidate = LOW;
+      volatile bool isrBouncing = false;
+      volatile unsigned long isrFirstEdgeUs = 0;
+      volatile unsigned long isrLastEdgeUs = 0;
+      volatile long isrFirstEdgeCount = 0;
+      volatile SenseEdge edges[2] = {{false, 0, 0}, {false, 0, 0}};
+    #endif
+
     int pin;
     int activeState = OFF;
     bool isAnalog;
@@ -68,11 +128,29 @@ class Sense {
     // \param handle      sense handle
     int changed(uint8_t handle);
 
+    // set a value to be latched (motor steps for example) when the sense input changes state
+    // \param handle      sense handle
+    // \param source      value to latch, must be safe to read from an ISR
+    void setLatch(uint8_t handle, volatile long *source);
+
+    // get the last debounced edge of an interrupt driven sense input
+    // \param handle      sense handle
+    // \param on          true for the edge into the triggered state, false for the edge out of it
+    // \param timeUs      set to the micros() time of the edge's first transition
+    // \param count       set to the latch source value at that time
+    // \returns           true if the edge was seen since the last call
+    bool edge(uint8_t handle, bool on, unsigned long *timeUs, long *count);
+
+    // true if the sense input is interrupt driven
+    // \param handle      sense handle
+    bool isInterruptDriven(uint8_t handle);
+
     // call repeatedly to check inputs for changes
     void poll();
 
   private:
     uint8_t senseCount = 0;
+    uint8_t isrCount = 0;
     SenseInput *senseInput[SENSE_MAX];
 };
 
@@ -36,66 +36,51 @@
   }
 
   void IPSerial::end() {
-    if (cmdSvrClient.connected()) {
-      #if DEBUG_CMDSERVER == ON
-        VLF("MSG: end(), STOP cmdSvrClient");
-      #endif
-      cmdSvrClient.stop();
+    for (uint8_t i = 0; i < SERIAL_SERVER_CLIENTS; i++) {
+      if (clients[i].client.connected()) {
+        #if DEBUG_CMDSERVER == ON
+          VF("MSG: end(), STOP cmdSvrClient "); VL(i);
+        #endif
+        drop(i);
+      }
     }
   }
 
   int IPSerial::available(void) {
     if (!ethernetManager.active) return 0;
 
-    if (!cmdSvrClient) {
-      cmdSvrClient = cmdSvr->available();
-      if (cmdSvrClient) {
-        #if DEBUG_CMDSERVER == ON
-          VLF("MSG: available(), NEW cmdSvrClient");
-        #endif
-        clientEndTimeMs = millis() + clientTimeoutMs;
-        cmdSvrClient.setTimeout(1000);
-      }
-    } else {
-      if (!cmdSvrClient.connected()) { 
-        #if DEBUG_CMDSERVER == ON
-          VLF("MSG: available(), not connected STOP cmdSvrClient");
-        #endif
-        cmdSvrClient.stop();
-        return 0;
-      }
-      if ((long)(clientEndTimeMs - millis()) < 0) {
-        #if DEBUG_CMDSERVER == ON
-          VLF("MSG: available(), timed out STOP cmdSvrClient");
-        #endif
-        cmdSvrClient.stop();
-        return 0;
-      }
-    }
+    service();
 
-    int i = cmdSvrClient.available();
+    // the current command has been fully read (and replied to,) move on to the next client
+    if (current >= 0 && readPos >= clients[current].framePos) {
+      clients[current].framePos = 0;
+      clients[current].frameReady = false;
+      if (!selectNext()) return 0;
+    } else
+    if (current < 0 && !selectNext()) return 0;
+
+    int i = clients[current].framePos - readPos;
 
     #if DEBUG_CMDSERVER == ON
-      if (i > 0) { VF("MSG: available(), recv. buffer has "); V(i); VLF(" chars"); }
+      if (i > 0) { VF("MSG: available(), client "); V(current); VF(" has "); V(i); VLF(" chars"); }
     #endif
 
     return i;
   }
 
   int IPSerial::peek(void) {
-    if (!ethernetManager.active || !cmdSvrClient) return -1;
-    return cmdSvrClient.peek();
+    if (!ethernetManager.active || current < 0 || readPos >= clients[current].framePos) return -1;
+    return clients[current].frame[readPos];
   }
 
   void IPSerial::flush(void) {
-    if (!ethernetManager.active || !cmdSvrClient) return;
-    cmdSvrClient.flush();
+    if (!ethernetManager.active || current < 0 || !clients[current].client) return;
+    clients[current].client.flush();
   }
 
   int IPSerial::read(void) {
-    if (!ethernetManager.active || !cmdSvrClient) return -1;
-    if (persist) clientEndTimeMs = millis() + clientTimeoutMs;
-    int c = cmdSvrClient.read();
+    if (!ethernetManager.active || current < 0 || readPos >= clients[current].framePos) return -1;
+    int c = clients[current].frame[readPos++];
     #if DEBUG_CMDSERVER == ON
       VF("MSG: read(), found: "); VL((char)c);
     #endif
@@ -103,13 +88,88 @@
   }
 
   size_t IPSerial::write(uint8_t data) {
-    if (!ethernetManager.active || !cmdSvrClient) return 0;
-    return cmdSvrClient.write(data);
+    if (!ethernetManager.active || current < 0 || !clients[current].client) return 0;
+    return clients[current].client.write(data);
   }
 
   size_t IPSerial::write(const uint8_t *data, size_t count) {
-    if (!ethernetManager.active || !cmdSvrClient) return 0;
-    return cmdSvrClient.write(data, count);
+    if (!ethernetManager.active || current < 0 || !clients[current].client) return 0;
+    return clients[current].client.write(data, count);
+  }
+
+  void IPSerial::service() {
+    // new clients go into any free slot, otherwise they wait for one to open up
+    EthernetClient newClient = cmdSvr->available();
+    if (newClient) {
+      int8_t freeSlot = -1;
+      bool known = false;
+      for (uint8_t i = 0; i < SERIAL_SERVER_CLIENTS; i++) {
+        if (clients[i].client) { if (clients[i].client == newClient) known = true; } else if (freeSlot < 0) freeSlot = i;
+      }
+      if (!known && freeSlot >= 0) {
+        clients[freeSlot].client = newClient;
+        clients[freeSlot].client.setTimeout(1000);
+        clients[freeSlot].endTimeMs = millis() + clientTimeoutMs;
+        clients[freeSlot].framePos = 0;
+        clients[freeSlot].frameReady = false;
+        #if DEBUG_CMDSERVER == ON
+          VF("MSG: service(), NEW cmdSvrClient "); VL(freeSlot);
+        #endif
+      }
+    }
+
+    for (uint8_t i = 0; i < SERIAL_SERVER_CLIENTS; i++) {
+      IPSerialClient *c = &clients[i];
+      if (!c->client) continue;
+
+      // leave the client being read from alone until its command is finished
+      if (i == current) continue;
+
+      if (!c->client.connected()) {
+        #if DEBUG_CMDSERVER == ON
+          VF("MSG: service(), not connected STOP cmdSvrClient "); VL(i);
+        #endif
+        drop(i);
+        continue;
+      }
+      if ((long)(c->endTimeMs - millis()) < 0) {
+        #if DEBUG_CMDSERVER == ON
+          VF("MSG: service(), timed out STOP cmdSvrClient "); VL(i);
+        #endif
+        drop(i);
+        continue;
+      }
+
+      // gather one command frame at a time, the rest waits in the client's own receive buffer
+      while (!c->frameReady && c->client.available() > 0) {
+        char b = c->client.read();
+        if (persist) c->endTimeMs = millis() + clientTimeoutMs;
+
+        if (c->framePos >= IPSERIAL_FRAME_SIZE) c->framePos = IPSERIAL_FRAME_SIZE - 1;
+        c->frame[c->framePos++] = b;
+
+        // (char)6 on its own is a complete LX200 status command
+        if (b == '#' || (b == (char)6 && c->framePos == 1)) c->frameReady = true;
+      }
+    }
+  }
+
+  void IPSerial::drop(uint8_t i) {
+    clients[i].client.stop();
+    clients[i].framePos = 0;
+    clients[i].frameReady = false;
+    if (current == i) current = -1;
+  }
+
+  bool IPSerial::selectNext() {
+    uint8_t start = (current < 0) ? 0 : current + 1;
+    current = -1;
+    readPos = 0;
+    for (uint8_t n = 0; n < SERIAL_SERVER_CLIENTS; n++) {
+      uint8_t i = (start + n) % SERIAL_SERVER_CLIENTS;
+      if (clients[i].frameReady) { current = i; return true; }
+    }
+    return false;
   }
 
   #if SERIAL_SERVER == STANDARD || SERIAL_SERVER == BOTH
@@ -17,6 +17,17 @@
     #include <Ethernet.h>   // built-in library or my https://github.com/hjd1964/Ethernet for ESP32 and ASCOM Alpaca support
   #endif
 
+  #define IPSERIAL_FRAME_SIZE 80
+
+  // one connected client along with the command it is sending
+  typedef struct IPSerialClient {
+    EthernetClient client;
+    unsigned long endTimeMs;
+    char frame[IPSERIAL_FRAME_SIZE];
+    uint8_t framePos;
+    bool frameReady;
+  } IPSerialClient;
+
   class IPSerial : public Stream {
     public:
       void begin(long port, unsigned long clientTimeoutMs = 2000, bool persist = false);
@@ -45,12 +56,24 @@
       using Print::write;
 
     private:
+      // accept new clients, drop stale ones, and gather incoming bytes into per-client command frames
+      void service();
+
+      // disconnect a client and discard any partial command
+      void drop(uint8_t i);
+
+      // select the next client (round-robin) that has a complete command waiting
+      bool selectNext();
+
       EthernetServer *cmdSvr;
-      EthernetClient cmdSvrClient;
+      IPSerialClient clients[SERIAL_SERVER_CLIENTS];
+
+      // the client whose command is being read and who gets the reply
+      int8_t current = -1;
+      uint8_t readPos = 0;
 
       int port = -1;
       unsigned long clientTimeoutMs;
-      unsigned long clientEndTimeMs = 0;
       bool active = false;
       bool persist = false;
   };
@@ -7,11 +7,13 @@
 
 void SerialLocal::begin(long baud) {
   // init the buffers
-  xmit_index = 0;
-  xmit_buffer[0] = 0;
-  recv_head = 0;
-  recv_tail = 0;
-  recv_buffer[0] = 0;
+  cmdHead = 0;
+  cmdTail = 0;
+  readPos = 0;
+  currentId = 0;
+  currentReply = NULL;
+  for (int i = 0; i < SERIAL_LOCAL_REPLY_SLOTS; i++) replySlot[i].state = RSS_FREE;
+  receiveResult[0] = 0;
   (void)(baud);
 
   #ifdef ESP32
@@ -21,58 +23,169 @@ void SerialLocal::begin(long baud) {
 
 void SerialLocal::end() { }
 
-void SerialLocal::transmit(const char *data) {
-  #ifdef ESP32
-    xSemaphoreTake(mutex, portMAX_DELAY);
-  #endif
-
+uint8_t SerialLocal::transmit(const char *data, bool replyWanted) {
   int data_len = strlen(data);
-  for (int i = 0; i < data_len; i++) {
-    recv_buffer[recv_tail] = data[i];
-    recv_tail++;
-  }
+  if (data_len == 0) return 0;
+  if (data_len > SERIAL_LOCAL_CMD_SIZE) { DF("WRN: SerialLocal, command too long "); DL(data); return 0; }
 
-  #ifdef ESP32
-    xSemaphoreGive(mutex);
-  #endif
+  // each command gets its own slot and reply id so strings holding several commands are refused
+  const char *terminator = strchr(data, '#');
+  if (terminator != NULL && terminator[1] != 0) { DF("WRN: SerialLocal, more than one command "); DL(data); return 0; }
+
+  SERIAL_LOCAL_LOCK();
+  if ((uint8_t)(cmdTail - cmdHead) >= SERIAL_LOCAL_CMD_SLOTS) { SERIAL_LOCAL_UNLOCK(); return 0; }
+
+  CommandSlot *slot = &cmdSlot[cmdTail & (SERIAL_LOCAL_CMD_SLOTS - 1)];
+  uint8_t id = nextId++;
+  if (nextId == 0) nextId = 1;
+
+  slot->id = id;
+  slot->length = data_len;
+  slot->replyWanted = replyWanted;
+  memcpy(slot->data, data, data_len);
+  cmdTail++;
+
+  SERIAL_LOCAL_UNLOCK();
+  return id;
 }
 
 char *SerialLocal::receive() {
-  #ifdef ESP32
-    xSemaphoreTake(mutex, portMAX_DELAY);
-  #endif
-
   int i = 0;
-  xmit_result[i] = 0;
-  while (xmit_buffer[xmit_index] != 0) {
-    xmit_result[i++] = xmit_buffer[xmit_index++];
-    xmit_index &= 0b1111111;
+  receiveResult[0] = 0;
+
+  SERIAL_LOCAL_LOCK();
+
+  // gather all waiting replies oldest first
+  ReplySlot *oldest;
+  do {
+    oldest = NULL;
+    for (int j = 0; j < SERIAL_LOCAL_REPLY_SLOTS; j++) {
+      if (replySlot[j].state != RSS_READY) continue;
+      if (oldest == NULL || (int8_t)(replySlot[j].id - oldest->id) < 0) oldest = &replySlot[j];
+    }
+    if (oldest != NULL) {
+      for (int k = 0; k < oldest->length && i < (int)sizeof(receiveResult) - 1; k++) receiveResult[i++] = oldest->data[k];
+      receiveResult[i] = 0;
+      oldest->state = RSS_FREE;
+    }
+  } while (oldest != NULL);
+
+  SERIAL_LOCAL_UNLOCK();
+  return receiveResult;
+}
+
+bool SerialLocal::receive(uint8_t id, char *reply) {
+  bool found = false;
+
+  SERIAL_LOCAL_LOCK();
+  for (int j = 0; j < SERIAL_LOCAL_REPLY_SLOTS; j++) {
+    if (replySlot[j].state == RSS_READY && replySlot[j].id == id) {
+      memcpy(reply, replySlot[j].data, replySlot[j].length);
+      reply[replySlot[j].length] = 0;
+      replySlot[j].state = RSS_FREE;
+      found = true;
+      break;
+    }
   }
-  xmit_result[i] = 0; 
+  SERIAL_LOCAL_UNLOCK();
 
-  #ifdef ESP32
-    xSemaphoreGive(mutex);
-  #endif
-  return xmit_result;
+  return found;
 }
 
-int SerialLocal::read(void) {
-  if (!available()) return -1;
+int SerialLocal::receiveAvailable() {
+  int count = 0;
+  SERIAL_LOCAL_LOCK();
+  for (int j = 0; j < SERIAL_LOCAL_REPLY_SLOTS; j++) if (replySlot[j].state == RSS_READY) count += replySlot[j].length;
+  SERIAL_LOCAL_UNLOCK();
+  return count;
+}
 
-  #ifdef ESP32
-    xSemaphoreTake(mutex, portMAX_DELAY);
-  #endif
+int SerialLocal::available(void) {
+  SERIAL_LOCAL_LOCK();
+  int count = availableLocked();
+  SERIAL_LOCAL_UNLOCK();
+  return count;
+}
+
+int SerialLocal::peek(void) {
+  int c = -1;
+  SERIAL_LOCAL_LOCK();
+  if (availableLocked()) c = cmdSlot[cmdHead & (SERIAL_LOCAL_CMD_SLOTS - 1)].data[readPos];
+  SERIAL_LOCAL_UNLOCK();
+  return c;
+}
 
-  recv_buffer[recv_tail] = 0;
-  char c = recv_buffer[recv_head];
-  if (c) recv_head++;
+int SerialLocal::read(void) {
+  SERIAL_LOCAL_LOCK();
+  if (!availableLocked()) { SERIAL_LOCAL_UNLOCK(); return -1; }
+
+  CommandSlot *slot = &cmdSlot[cmdHead & (SERIAL_LOCAL_CMD_SLOTS - 1)];
+  char c = slot->data[readPos++];
+
+  // the whole command has been read, any reply written from now on belongs to it (or is discarded)
+  if (readPos >= slot->length) {
+    currentId = slot->replyWanted ? slot->id : 0;
+    currentReply = NULL;
+    readPos = 0;
+    cmdHead++;
+  }
 
-  #ifdef ESP32
-    xSemaphoreGive(mutex);
-  #endif
+  SERIAL_LOCAL_UNLOCK();
   return c;
 }
 
+size_t SerialLocal::write(const uint8_t *data, size_t count) {
+  size_t written = count;
+
+  SERIAL_LOCAL_LOCK();
+  if (currentId == 0) { SERIAL_LOCAL_UNLOCK(); return count; }
+
+  if (currentReply == NULL) {
+    currentReply = replySlotAllocate();
+    currentReply->id = currentId;
+    currentReply->length = 0;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    if (currentReply->length >= SERIAL_LOCAL_REPLY_SIZE - 1) { written = i; break; }
+    currentReply->data[currentReply->length++] = data[i];
+  }
+  SERIAL_LOCAL_UNLOCK();
+
+  return written;
+}
+
+int SerialLocal::availableLocked() {
+  complete();
+  if (cmdHead == cmdTail) return 0;
+  return cmdSlot[cmdHead & (SERIAL_LOCAL_CMD_SLOTS - 1)].length - readPos;
+}
+
+void SerialLocal::complete() {
+  if (currentId == 0) return;
+
+  if (currentReply == NULL) {
+    currentReply = replySlotAllocate();
+    currentReply->id = currentId;
+    currentReply->length = 0;
+  }
+
+  currentReply->state = RSS_READY;
+
+  currentId = 0;
+  currentReply = NULL;
+}
+
+ReplySlot *SerialLocal::replySlotAllocate() {
+  ReplySlot *oldest = NULL;
+  for (int j = 0; j < SERIAL_LOCAL_REPLY_SLOTS; j++) {
+    if (replySlot[j].state == RSS_FREE) { oldest = &replySlot[j]; break; }
+    if (oldest == NULL || (int8_t)(replySlot[j].id - oldest->id) < 0) oldest = &replySlot[j];
+  }
+  oldest->state = RSS_WRITING;
+  return oldest;
+}
+
 SerialLocal serialLocal;
 
 #endif
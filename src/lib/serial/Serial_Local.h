@@ -6,6 +6,41 @@
 
 #if defined(SERIAL_LOCAL_MODE) && SERIAL_LOCAL_MODE == ON
 
+// commands are queued whole (one per slot) and handed to the command processor in order, each
+// reply is returned in a slot tagged with the id transmit() gave for its command
+#define SERIAL_LOCAL_CMD_SLOTS      8   // must be a power of two
+#ifndef SERIAL_LOCAL_CMD_SIZE
+  #define SERIAL_LOCAL_CMD_SIZE     96  // longest command that can be sent, up to 255
+#endif
+#define SERIAL_LOCAL_REPLY_SLOTS    4
+#define SERIAL_LOCAL_REPLY_SIZE     64
+
+// commands can be sent from any task (ST4, etc.) so on multi-core processors the
+// queues are protected by a mutex, elsewhere tasks are cooperative and can't interrupt each other
+#ifdef ESP32
+  #define SERIAL_LOCAL_LOCK() xSemaphoreTake(mutex, portMAX_DELAY)
+  #define SERIAL_LOCAL_UNLOCK() xSemaphoreGive(mutex)
+#else
+  #define SERIAL_LOCAL_LOCK()
+  #define SERIAL_LOCAL_UNLOCK()
+#endif
+
+enum ReplySlotState: uint8_t {RSS_FREE, RSS_WRITING, RSS_READY};
+
+typedef struct CommandSlot {
+  uint8_t id;
+  uint8_t length;
+  bool replyWanted;
+  char data[SERIAL_LOCAL_CMD_SIZE];
+} CommandSlot;
+
+typedef struct ReplySlot {
+  volatile ReplySlotState state;
+  uint8_t id;
+  uint8_t length;
+  char data[SERIAL_LOCAL_REPLY_SIZE];
+} ReplySlot;
+
 class SerialLocal : public Stream {
   public:
     inline void begin() { begin(9600); }
@@ -14,63 +49,27 @@ class SerialLocal : public Stream {
 
     void setTimeout(long timeMs) { UNUSED(timeMs); }
 
-    // sends a command for processing
-    void transmit(const char *data);
+    // sends a single command for processing, with replyWanted false the reply is discarded (no reply
+    // slot is used) so commands whose reply is never collected don't push out the replies of others
+    // returns the id to collect the reply with or 0 if the command can't be queued (the queue is
+    // full, the command is longer than SERIAL_LOCAL_CMD_SIZE, or more than one command was given)
+    uint8_t transmit(const char *data, bool replyWanted = true);
 
     // receive has the last commands response, if one exists
     char *receive();
 
-    int read(void);
-
-    inline int receiveAvailable() {
-      #ifdef ESP32
-        xSemaphoreTake(mutex, portMAX_DELAY);
-      #endif
-
-      int i = 0;
-      int x = xmit_index;
-      while (xmit_buffer[xmit_index] != 0) {
-        i++;
-        xmit_index++;
-        xmit_index &= 0b1111111;
-      }
-      xmit_index = x;
+    // gets the reply for the command with this id, reply must hold SERIAL_LOCAL_REPLY_SIZE chars
+    // returns true if the command was processed (the reply may be empty)
+    bool receive(uint8_t id, char *reply);
 
-      #ifdef ESP32
-        xSemaphoreGive(mutex);
-      #endif
-      return i;
-    }
-
-    inline int available(void) { 
-      #ifdef ESP32
-        xSemaphoreTake(mutex, portMAX_DELAY);
-      #endif
-
-      uint8_t p = recv_head;
-      uint8_t c = 0;
-      while (recv_buffer[p] && p != recv_tail && c < 255) { c++; p++; }
-
-      #ifdef ESP32
-        xSemaphoreGive(mutex);
-      #endif
-      return c;
-    }
+    int read(void);
 
-    inline int peek(void) {
-      if (!available()) return -1;
+    // total length of replies waiting to be collected
+    int receiveAvailable();
 
-      #ifdef ESP32
-        xSemaphoreTake(mutex, portMAX_DELAY);
-      #endif
+    int available(void);
 
-      char c = recv_buffer[recv_head];
-
-      #ifdef ESP32
-        xSemaphoreGive(mutex);
-      #endif
-      return c;
-    }
+    int peek(void);
 
     inline void flush(void) {
       #ifdef ESP32
@@ -78,26 +77,9 @@ class SerialLocal : public Stream {
       #endif
     }
 
-    inline size_t write(uint8_t data) {
-      #ifdef ESP32
-        xSemaphoreTake(mutex, portMAX_DELAY);
-      #endif
+    inline size_t write(uint8_t data) { return write(&data, 1); }
 
-      xmit_buffer[xmit_tail] = data;
-      xmit_tail++;
-      xmit_tail &= 0b1111111;
-      xmit_buffer[xmit_tail] = 0;
-
-      #ifdef ESP32
-        xSemaphoreGive(mutex);
-      #endif
-      return 1;
-    }
-
-    size_t write(const uint8_t* data, size_t count) {
-      for (int i = 0; i < (int)count; i++) { if (!write(data[i])) return i; }
-      return count;
-    }
+    size_t write(const uint8_t* data, size_t count);
 
     inline size_t write(unsigned long n) { return write((uint8_t)n); }
     inline size_t write(long n) { return write((uint8_t)n); }
@@ -107,15 +89,31 @@ class SerialLocal : public Stream {
     using Print::write;
 
   private:
-    char recv_buffer[256] = "";
-    uint8_t recv_head = 0;
-    uint8_t recv_tail = 0;
-
-    char xmit_buffer[128] = "";
-    char xmit_result[128] = "";
-    uint8_t xmit_index = 0;
-    uint8_t xmit_tail = 0;
-    
+    // characters left in the command being read, the caller must hold the lock
+    int availableLocked();
+
+    // once a command has been read and replied to, release its reply (an empty one if none was written)
+    // the caller must hold the lock
+    void complete();
+
+    // finds a slot for a new reply, evicting the oldest uncollected reply if necessary
+    // the caller must hold the lock
+    ReplySlot *replySlotAllocate();
+
+    // commands waiting for the command processor
+    CommandSlot cmdSlot[SERIAL_LOCAL_CMD_SLOTS];
+    uint8_t cmdHead = 0;
+    uint8_t cmdTail = 0;
+    uint8_t readPos = 0;
+    uint8_t nextId = 1;
+
+    // the command the processor last read and where its reply is going
+    uint8_t currentId = 0;
+    ReplySlot *currentReply = NULL;
+
+    ReplySlot replySlot[SERIAL_LOCAL_REPLY_SLOTS];
+    char receiveResult[SERIAL_LOCAL_REPLY_SIZE*2];
+
     #ifdef ESP32
       SemaphoreHandle_t mutex;
     #endif
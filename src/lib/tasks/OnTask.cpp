@@ -472,6 +472,13 @@ IRAM_ATTR void Tasks::setPeriodRatioSubMicros(unsigned long value) {
   _taskMasterFrequencyRatio = value;
 }
 
+unsigned long Tasks::getPeriodRatioSubMicros() {
+  noInterrupts();
+  unsigned long value = _taskMasterFrequencyRatio;
+  interrupts();
+  return value;
+}
+
 void Tasks::setDuration(uint8_t handle, unsigned long duration) {
   if (handle != 0 && allocated[handle - 1]) {
     task[handle - 1]->setDuration(duration);
@@ -272,6 +272,9 @@ class Tasks {
     // values below 16M cause the timers to compensate by running faster
     IRAM_ATTR void setPeriodRatioSubMicros(unsigned long value);
 
+    // get the period ratio, in sub-microseconds per second
+    unsigned long getPeriodRatioSubMicros();
+
     // set process to run immediately on the next pass (within its priority level)
     IRAM_ATTR inline void immediate(uint8_t handle) { if (handle != 0 && allocated[handle - 1]) { task[handle - 1]->immediate = true; } }
 
@@ -7,20 +7,13 @@
 
 #include "../tasks/OnTask.h"
 
-void ppsIsr() {
-  unsigned long t = micros();
-  unsigned long oneSecond = t - pps.lastMicros;
-  if (oneSecond > 1000000 - PPS_WINDOW_MICROS && oneSecond < 1000000 + PPS_WINDOW_MICROS) {
-    pps.averageMicros = (pps.averageMicros*(PPS_SECS_TO_AVERAGE - 1) + oneSecond)/PPS_SECS_TO_AVERAGE;
-    pps.synced = true;
-    tasks.setPeriodRatioSubMicros(pps.averageMicros*16UL);
-  } else {
-    pps.synced = false;
-    tasks.setPeriodRatioSubMicros(16000000UL);
-  }
-  pps.lastMicros = t;
+IRAM_ATTR void ppsIsr() {
+  pps.edgeMicros = micros();
+  pps.edgeCount++;
 }
 
+inline void ppsWrapper() { pps.poll(); }
+
 void Pps::init() {
     VLF("MSG: PPS, attaching ISR to sense input");
     pinMode(PPS_SENSE_PIN, INPUT_PULLUP);
@@ -31,6 +24,113 @@ void Pps::init() {
     #elif TIME_LOCATION_PPS_SENSE == BOTH
       attachInterrupt(digitalPinToInterrupt(PPS_SENSE_PIN), ppsIsr, CHANGE);
     #endif
+
+    VF("MSG: PPS, start clock discipline task (rate "); V(PPS_POLL_MS); VF("ms priority 6)... ");
+    if (tasks.add(PPS_POLL_MS, 0, true, 6, ppsWrapper, "PPS")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+// update the clock discipline from the last PPS edge
+void Pps::poll() {
+  noInterrupts();
+  unsigned long count = edgeCount;
+  unsigned long t = edgeMicros;
+  interrupts();
+
+  if (count != lastEdgeCount) {
+    if (lastEdgeCount == 0) lastEdgeMicros = t; else {
+      // edges less than about a second after the last good one (glitches or the other edge) are ignored
+      unsigned long interval = t - lastEdgeMicros;
+      long seconds = lround(interval/frequencyMicros);
+      if (seconds >= 1 && update(interval, seconds)) {
+        lastEdgeMicros = t;
+        lastGoodMs = millis();
+        holdover = false;
+      } else if (!acquired) lastEdgeMicros = t;
+    }
+    lastEdgeCount = count;
+  }
+
+  // holdover, keep the last good frequency without any phase correction
+  if (acquired && !holdover && (long)(millis() - lastGoodMs) > PPS_HOLDOVER_MS) {
+    VLF("MSG: PPS, signal lost holding the last frequency");
+    holdover = true;
+    synced = false;
+    goodCount = 0;
+    phaseErrorMicros = 0.0;
+    setPeriod(frequencyMicros);
+  }
+}
+
+// accepts a PPS edge count seconds after the last accepted edge, returns false for an outlier
+bool Pps::update(unsigned long interval, long count) {
+  double perSecond = (double)interval/count;
+
+  if (!acquired) {
+    if (count != 1 || fabs(perSecond - 1000000.0) > PPS_WINDOW_MICROS) return false;
+    VLF("MSG: PPS, acquired");
+    acquired = true;
+    frequencyMicros = perSecond;
+    phaseErrorMicros = 0.0;
+    goodCount = 0;
+    outlierCount = 0;
+    setPeriod(frequencyMicros);
+    return true;
+  }
+
+  if (fabs(perSecond - frequencyMicros) > PPS_OUTLIER_MICROS) {
+    statsOutliers++;
+    if (++outlierCount < PPS_OUTLIER_MAX) return false;
+
+    // the edges really moved (or the last good edge wasn't), start again from this edge
+    VLF("MSG: PPS, too many outliers restarting from this edge");
+    outlierCount = 0;
+    goodCount = 0;
+    synced = false;
+    phaseErrorMicros = 0.0;
+    if (fabs(perSecond - 1000000.0) > PPS_WINDOW_MICROS) acquired = false;
+    setPeriod(frequencyMicros);
+    return true;
+  }
+  outlierCount = 0;
+
+  // the edge relative to where the clock put the second, before updating the frequency
+  phaseErrorMicros += (double)interval - count*periodMicros;
+  if (fabs(phaseErrorMicros) > PPS_PHASE_STEP_MICROS) {
+    VF("MSG: PPS, phase error of "); V(phaseErrorMicros); VLF("us too large to slew out, discarded");
+    phaseErrorMicros = 0.0;
+  }
+
+  frequencyMicros += (perSecond - frequencyMicros)/PPS_FREQ_TIME_CONSTANT;
+
+  // slew out the phase error, a positive error means the clock's seconds are too short
+  double correction = phaseErrorMicros/PPS_PHASE_TIME_CONSTANT;
+  if (correction > PPS_SLEW_MAX_MICROS) correction = PPS_SLEW_MAX_MICROS; else
+  if (correction < -PPS_SLEW_MAX_MICROS) correction = -PPS_SLEW_MAX_MICROS;
+  setPeriod(frequencyMicros + correction);
+
+  if (goodCount < PPS_ACQUIRE_SECS) goodCount++; else synced = true;
+
+  // time error statistics
+  #if DEBUG == VERBOSE
+    statsSumSq += phaseErrorMicros*phaseErrorMicros;
+    if (fabs(phaseErrorMicros) > statsMax) statsMax = fabs(phaseErrorMicros);
+    if (++statsCount >= PPS_STATS_SECS) {
+      VF("MSG: PPS, frequency "); V(frequencyMicros); VF("us/s time error rms "); V(sqrt(statsSumSq/statsCount));
+      VF("us max "); V(statsMax); VF("us outliers "); VL(statsOutliers);
+      statsSumSq = 0.0;
+      statsMax = 0.0;
+      statsCount = 0;
+      statsOutliers = 0;
+    }
+  #endif
+
+  return true;
+}
+
+// sets the task period ratio (used by the timers and sidereal clock)
+void Pps::setPeriod(double period) {
+  periodMicros = period;
+  tasks.setPeriodRatioSubMicros(lround(period*16.0));
 }
 
 Pps pps;
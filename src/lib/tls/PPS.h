@@ -5,8 +5,19 @@
 
 #if defined(TIME_LOCATION_PPS_SENSE) && TIME_LOCATION_PPS_SENSE != OFF
 
-#define PPS_SECS_TO_AVERAGE 40   // running average of 40 samples (1 per second)
-#define PPS_WINDOW_MICROS 20000  // +/- window in microseconds to meet synced criteria (2%)
+// the PPS edges discipline the MCU clock: the frequency (microseconds per second) follows the measured
+// intervals and the phase error (time from the clock's second to the edge) is slewed out gradually
+#define PPS_WINDOW_MICROS 20000       // +/- window in microseconds for the first interval (2%)
+#define PPS_OUTLIER_MICROS 1000       // intervals this far from the frequency are ignored once acquired
+#define PPS_OUTLIER_MAX 4             // consecutive outliers before the phase is stepped to the edges
+#define PPS_FREQ_TIME_CONSTANT 32     // frequency servo time constant in seconds
+#define PPS_PHASE_TIME_CONSTANT 8     // phase servo time constant in seconds
+#define PPS_PHASE_STEP_MICROS 10000   // larger phase errors are discarded (and logged) rather than slewed
+#define PPS_SLEW_MAX_MICROS 500       // limits the phase correction to +/- 500 ppm
+#define PPS_ACQUIRE_SECS 8            // good intervals before synced
+#define PPS_HOLDOVER_MS 2500          // without a good edge this long the last good frequency is held
+#define PPS_POLL_MS 100               // rate the servo checks for a new edge
+#define PPS_STATS_SECS 60             // the time error statistics period (VERBOSE)
 
 #if !defined(PPS_SENSE_PIN) || PPS_SENSE_PIN == OFF
   #error "Configuration (Config.h): PPS_SENSE_PIN must be defined for TIME_LOCATION_PPS_SENSE ON"
@@ -17,11 +28,44 @@ class Pps {
     // attach interrupt and start PPS
     void init();
 
+    // update the clock discipline from the last PPS edge
+    void poll();
+
     volatile bool synced = false;
 
-    volatile unsigned long averageMicros = 1000000;
-    volatile unsigned long lastMicros = 1000000;
+    // the measured MCU clock microseconds per second
+    double frequencyMicros = 1000000.0;
+
+    // the time from the disciplined clock's second to the last PPS edge, in microseconds
+    double phaseErrorMicros = 0.0;
+
+    // the clock period in effect (frequency with phase correction), in microseconds
+    double periodMicros = 1000000.0;
+
+    // set by the ISR
+    volatile unsigned long edgeMicros = 0;
+    volatile unsigned long edgeCount = 0;
+
   private:
+    // accepts a PPS edge count seconds after the last accepted edge, returns false for an outlier
+    bool update(unsigned long interval, long count);
+
+    // sets the task period ratio (used by the timers and sidereal clock)
+    void setPeriod(double period);
+
+    bool acquired = false;
+    bool holdover = false;
+    unsigned long lastEdgeCount = 0;
+    unsigned long lastEdgeMicros = 0;
+    unsigned long lastGoodMs = 0;
+    uint8_t goodCount = 0;
+    uint8_t outlierCount = 0;
+
+    // time error statistics
+    double statsSumSq = 0.0;
+    double statsMax = 0.0;
+    unsigned int statsCount = 0;
+    unsigned int statsOutliers = 0;
 };
 
 extern Pps pps;
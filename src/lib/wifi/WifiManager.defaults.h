@@ -25,6 +25,12 @@
 #define SERIAL_SERVER OFF                 // SERIAL_SIP, SERIAL_PIP1, etc.
 #endif
 
+// number of simultaneous clients each SERIAL_SERVER channel accepts, complete commands are taken
+// from each client in turn and the reply is returned to the client that sent the command
+#ifndef SERIAL_SERVER_CLIENTS
+#define SERIAL_SERVER_CLIENTS 2
+#endif
+
 // optional Arduino Serial class work-alike IP channel (ports 9996 to 9998) as a client (connects to a server)
 #ifndef SERIAL_CLIENT
 #define SERIAL_CLIENT OFF                 // ON to enable SERIAL_IP
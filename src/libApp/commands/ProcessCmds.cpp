@@ -53,6 +53,49 @@
   };
 #endif
 
+#if DEBUG_COMMAND_STATS == ON
+  // command throughput and reply latency (first char received to reply sent) across all channels,
+  // latency is binned by powers of two microseconds so percentiles are reported as an upper bound
+  #define STATS_BINS 24
+  static unsigned long statsCommands = 0;
+  static unsigned long statsLatencyMax = 0;
+  static unsigned long statsLatencyBin[STATS_BINS];
+  static unsigned long statsStartMs = 0;
+
+  static void commandStatsRecord(unsigned long latencyUs) {
+    uint8_t bin = 0;
+    while (bin < STATS_BINS - 1 && (latencyUs >> bin) > 1) bin++;
+    statsLatencyBin[bin]++;
+    if (latencyUs > statsLatencyMax) statsLatencyMax = latencyUs;
+    statsCommands++;
+  }
+
+  static unsigned long commandStatsPercentile(uint8_t percent) {
+    unsigned long target = (statsCommands*percent + 99)/100;
+    unsigned long count = 0;
+    for (uint8_t bin = 0; bin < STATS_BINS; bin++) {
+      count += statsLatencyBin[bin];
+      if (count >= target) return 1UL << (bin + 1);
+    }
+    return statsLatencyMax;
+  }
+
+  void commandStats() {
+    unsigned long periodMs = millis() - statsStartMs;
+    if (statsCommands > 0 && periodMs > 0) {
+      DF("MSG: Commands, "); D((statsCommands*1000.0F)/periodMs); DF(" cmds/s");
+      DF(", latency p50 <"); D(commandStatsPercentile(50));
+      DF("us p90 <"); D(commandStatsPercentile(90));
+      DF("us p99 <"); D(commandStatsPercentile(99));
+      DF("us max "); D(statsLatencyMax); DLF("us");
+    }
+    statsCommands = 0;
+    statsLatencyMax = 0;
+    for (uint8_t bin = 0; bin < STATS_BINS; bin++) statsLatencyBin[bin] = 0;
+    statsStartMs = millis();
+  }
+#endif
+
 // command processors
 #ifdef SERIAL_A
   CommandProcessor processCommandsA(SERIAL_A_BAUD_DEFAULT,'A');
@@ -135,6 +178,9 @@ void CommandProcessor::poll() {
 
   unsigned long tout = micros() + 500;
   while (SerialPort.available()) { 
+    #if DEBUG_COMMAND_STATS == ON
+      if (!frameStarted) { frameStartMicros = micros(); frameStarted = true; }
+    #endif
     char c = SerialPort.read();
     buffer.add(c);
     if (buffer.ready() || (long)(micros() - tout) > 0) {
@@ -143,30 +189,36 @@ void CommandProcessor::poll() {
   }
 
   if (buffer.ready()) {
-    char reply[80] = "";
+    reply.clear();
     bool numericReply = true;
     bool supressFrame = false;
 
-    commandError = command(reply, buffer.getCmd(), buffer.getParameter(), &supressFrame, &numericReply);
+    commandError = command(reply.get(), buffer.getCmd(), buffer.getParameter(), &supressFrame, &numericReply);
 
     if (numericReply) {
-      if (commandError != CE_NONE && commandError != CE_1) strcpy(reply,"0"); else strcpy(reply,"1");
+      if (commandError != CE_NONE && commandError != CE_1) reply.set("0"); else reply.set("1");
       supressFrame = true;
-    }
-    if (strlen(reply) > 0 || buffer.checksum) {
+    } else reply.set();
+
+    if (reply.length() > 0 || buffer.checksum) {
       if (buffer.checksum) {
-        appendChecksum(reply);
-        strcat(reply, buffer.getSeq());
+        reply.appendChecksum();
+        reply.append(buffer.getSeq());
         supressFrame = false;
       }
-      if (!supressFrame) strcat(reply,"#");
-      SerialPort.write(reply);
+      if (!supressFrame) reply.append('#');
+      SerialPort.write((const uint8_t*)reply.get(), reply.length());
     }
 
+    #if DEBUG_COMMAND_STATS == ON
+      commandStatsRecord(micros() - frameStartMicros);
+      frameStarted = false;
+    #endif
+
     // debug, log errors and/or commands
     #if DEBUG_ECHO_COMMANDS != OFF
       if (DEBUG_ECHO_COMMANDS == ON || commandError > CE_0) {
-        DF("MSG: cmd"); D(channel); D(" = "); D(buffer.getCmd()); D(buffer.getParameter()); DF(", reply = "); D(reply);
+        DF("MSG: cmd"); D(channel); D(" = "); D(buffer.getCmd()); D(buffer.getParameter()); DF(", reply = "); D(reply.get());
       }
     #endif
     if (commandError != CE_NULL) {
@@ -258,13 +310,6 @@ CommandError CommandProcessor::command(char *reply, char *command, char *paramet
   return CE_CMD_UNKNOWN;
 }
 
-void CommandProcessor::appendChecksum(char *s) {
-  char HEXS[3] = "";
-  uint8_t cks = 0; for (unsigned int cksCount0 = 0; cksCount0 < strlen(s); cksCount0++) { cks += s[cksCount0]; }
-  sprintf(HEXS, "%02X", cks);
-  strcat(s, HEXS);
-}
-
 void commandChannelInit() {
   // Command processing
   // add tasks to process commands
@@ -339,4 +384,8 @@ void commandChannelInit() {
     VF("MSG: Setup, start command channel Local task (priority 5)... ");
     if (tasks.add(3, 0, true, 5, processCmdsLocal, "CmdL")) { VLF("success"); } else { VLF("FAILED!"); }
   #endif
+  #if DEBUG_COMMAND_STATS == ON
+    VF("MSG: Setup, start command statistics task (rate 10s priority 7)... ");
+    if (tasks.add(10000, 0, true, 7, commandStats, "CmdStat")) { VLF("success"); } else { VLF("FAILED!"); }
+  #endif
 }
@@ -21,15 +21,19 @@ class CommandProcessor {
 
   private:
     void logErrors(char *cmd, char *param, char *reply, CommandError e);
-    void appendChecksum(char *s);
 
     CommandError commandError      = CE_NONE;
     CommandError lastCommandError  = CE_NONE;
     bool serialReady               = false;
     long serialBaud                = 9600;
     char channel                   = '?';
+    #if DEBUG_COMMAND_STATS == ON
+      bool frameStarted            = false;
+      unsigned long frameStartMicros = 0;
+    #endif
 
     Buffer buffer;
+    ReplyBuffer reply;
     SerialWrapper SerialPort;
 };
 
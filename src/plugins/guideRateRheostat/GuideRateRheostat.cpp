@@ -41,9 +41,9 @@ void GuideRateRheostat::loop() {
       if (rate > fastestRate) rate = fastestRate;
 
       sprintF(s, ":RA%1.3f#", rate);
-      SERIAL_LOCAL.transmit(s);
+      SERIAL_LOCAL.transmit(s, false);
       sprintF(s, ":RE%1.3f#", rate);
-      SERIAL_LOCAL.transmit(s);
+      SERIAL_LOCAL.transmit(s, false);
       lastResistance = resistance;
     }
   #endif
@@ -16,16 +16,18 @@ void Sample::init() {
 }
 
 void Sample::loop() {
-  SERIAL_LOCAL.transmit(":GR#");
+  char reply[SERIAL_LOCAL_REPLY_SIZE];
+
+  uint8_t id = SERIAL_LOCAL.transmit(":GR#");
   // let OnStepX run for 0.1 second to process the command
   tasks.yield(100);
   Serial.print("RA = ");
-  Serial.println(SERIAL_LOCAL.receive());
+  if (SERIAL_LOCAL.receive(id, reply)) Serial.println(reply); else Serial.println("?");
 
-  SERIAL_LOCAL.transmit(":GD#");
+  id = SERIAL_LOCAL.transmit(":GD#");
   tasks.yield(100);
   Serial.print("Dec=");
-  Serial.println(SERIAL_LOCAL.receive());
+  if (SERIAL_LOCAL.receive(id, reply)) Serial.println(reply); else Serial.println("?");
 
   Serial.println();
 }
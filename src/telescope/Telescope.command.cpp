@@ -13,6 +13,7 @@
 #include "mount/Mount.h"
 #include "mount/goto/Goto.h"
 #include "mount/guide/Guide.h"
+#include "mount/guide/Predict.h"
 #include "mount/home/Home.h"
 #include "mount/library/Library.h"
 #include "mount/limits/Limits.h"
@@ -43,6 +44,9 @@ bool Telescope::command(char reply[], char command[], char parameter[], bool *su
     if (limits.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
     if (home.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
     if (pec.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
+    #if GUIDE_PREDICT == ON
+      if (guidePredict.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
+    #endif
     if (axis1.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
     if (axis2.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
   #endif
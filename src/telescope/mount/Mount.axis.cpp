@@ -31,6 +31,8 @@
 
   #if AXIS1_SERVO_FEEDBACK == FB_PID
     Pid pidAxis1(AXIS1_PID_P, AXIS1_PID_I, AXIS1_PID_D, AXIS1_PID_P_GOTO, AXIS1_PID_I_GOTO, AXIS1_PID_D_GOTO, AXIS1_PID_SENSITIVITY);
+  #elif AXIS1_SERVO_FEEDBACK == FB_CASCADE
+    Cascade pidAxis1(AXIS1_CASCADE_P, AXIS1_CASCADE_VP, AXIS1_CASCADE_VI, AXIS1_CASCADE_P_GOTO, AXIS1_CASCADE_VP_GOTO, AXIS1_CASCADE_VI_GOTO, AXIS1_CASCADE_ACCEL_FF, AXIS1_PID_SENSITIVITY);
   #endif
 
   #if defined(AXIS1_SERVO_DC)
@@ -95,6 +97,8 @@ Axis axis1(1, &PinsAxis1, &SettingsAxis1, AXIS_MEASURE_RADIANS, arcsecToRad(AXIS
 
   #if AXIS2_SERVO_FEEDBACK == FB_PID
     Pid pidAxis2(AXIS2_PID_P, AXIS2_PID_I, AXIS2_PID_D, AXIS2_PID_P_GOTO, AXIS2_PID_I_GOTO, AXIS2_PID_D_GOTO, AXIS2_PID_SENSITIVITY);
+  #elif AXIS2_SERVO_FEEDBACK == FB_CASCADE
+    Cascade pidAxis2(AXIS2_CASCADE_P, AXIS2_CASCADE_VP, AXIS2_CASCADE_VI, AXIS2_CASCADE_P_GOTO, AXIS2_CASCADE_VP_GOTO, AXIS2_CASCADE_VI_GOTO, AXIS2_CASCADE_ACCEL_FF, AXIS2_PID_SENSITIVITY);
   #endif
 
   #if defined(AXIS2_SERVO_DC)
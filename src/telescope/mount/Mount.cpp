@@ -11,6 +11,7 @@
 #include "coordinates/Transform.h"
 #include "goto/Goto.h"
 #include "guide/Guide.h"
+#include "guide/Predict.h"
 #include "home/Home.h"
 #include "library/Library.h"
 #include "limits/Limits.h"
@@ -93,6 +94,10 @@ void Mount::begin() {
     pec.init();
   #endif
 
+  #if GUIDE_PREDICT == ON
+    guidePredict.init();
+  #endif
+
   #if ST4_INTERFACE == ON
     st4.init();
   #endif
@@ -126,9 +131,23 @@ void Mount::begin() {
 }
 
 // get current equatorial position (Native coordinate system)
+// repeated queries within the same fractional second and axis step counts are answered from the cache
 Coordinate Mount::getPosition(CoordReturn coordReturn) {
+  unsigned long fs = site.getFracLAST();
+  long steps1 = axis1.getInstrumentCoordinateSteps();
+  long steps2 = axis2.getInstrumentCoordinateSteps();
+
+  PositionCache *cache = &positionCache[coordReturn];
+  if (cache->valid && cache->fs == fs && cache->steps1 == steps1 && cache->steps2 == steps2) return cache->position;
+
   updatePosition(coordReturn);
-  return transform.mountToNative(&current, false);
+  cache->position = transform.mountToNative(&current, false);
+  cache->fs = fs;
+  cache->steps1 = steps1;
+  cache->steps2 = steps2;
+  cache->valid = true;
+
+  return cache->position;
 }
 
 // get current equatorial position (Mount coordinate system)
@@ -137,6 +156,11 @@ Coordinate Mount::getMountPosition(CoordReturn coordReturn) {
   return current;
 }
 
+// discard cached getPosition() results
+void Mount::positionCacheInvalidate() {
+  for (int i = 0; i <= CR_MOUNT_ALL; i++) positionCache[i].valid = false;
+}
+
 // one time initialization of tracking
 void Mount::trackingAutostart() {
   static bool completed = false;
@@ -214,11 +238,17 @@ void Mount::update() {
     float f1 = 0, f2 = 0;
     if (!guide.activeAxis1() || guide.state == GU_PULSE_GUIDE) {
       f1 = trackingRateAxis1 + guide.rateAxis1 + pec.rate;
+      #if GUIDE_PREDICT == ON
+        f1 += guidePredict.rateAxis1;
+      #endif
       axis1.setFrequencyBase(siderealToRadF(f1)*SIDEREAL_RATIO_F*site.getSiderealRatio());
     }
 
     if (!guide.activeAxis2() || guide.state == GU_PULSE_GUIDE) {
       f2 = trackingRateAxis2 + guide.rateAxis2;
+      #if GUIDE_PREDICT == ON
+        f2 += guidePredict.rateAxis2;
+      #endif
       axis2.setFrequencyBase(siderealToRadF(f2)*SIDEREAL_RATIO_F*site.getSiderealRatio());
     }
 
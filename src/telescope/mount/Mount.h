@@ -56,6 +56,10 @@ class Mount {
     // get current equatorial position (Mount coordinate system)
     Coordinate getMountPosition(CoordReturn coordReturn = CR_MOUNT_EQU);
 
+    // discard cached getPosition() results, for changes that move the position without moving the axes
+    // (pointing model, site location, etc.)
+    void positionCacheInvalidate();
+
     // returns true if either of the mount motor drivers report a fault
     inline bool motorFault() { return axis1.motorFault() || axis2.motorFault(); }
 
@@ -117,6 +121,16 @@ class Mount {
     // also includes Mount normalized axis coordinates (a1, a2) where a2 is an instrument coordinate in tangent arm mode
     Coordinate current;
 
+    // getPosition() results by CoordReturn, each is valid for one fractional second and set of axis step counts
+    typedef struct PositionCache {
+      bool valid;
+      unsigned long fs;
+      long steps1;
+      long steps2;
+      Coordinate position;
+    } PositionCache;
+    PositionCache positionCache[CR_MOUNT_ALL + 1];
+
     TrackingState trackingState = TS_NONE;
 };
 
@@ -8,8 +8,6 @@
 #include "../../../libApp/weather/Weather.h"
 #include "../../Telescope.h"
 
-extern volatile unsigned long fracLAST;
-
 #define fsToRad(x) ((x)/(13750.98708313976*FRACTIONAL_SEC))
 #define radToFs(x) ((x)*(13750.98708313976*FRACTIONAL_SEC))
 
@@ -200,18 +198,14 @@ void Transform::mountToInstrument(Coordinate *coord, double *a1, double *a2) {
 }
 
 void Transform::hourAngleToRightAscension(Coordinate *coord, bool native) {
-  noInterrupts();
-  unsigned long fs = fracLAST;
-  interrupts();
+  double fs = site.getFracLASTExact();
   coord->r = fsToRad(fs) - coord->h;
   if (native) coord->r = backInRads(coord->r);
 }
 
 void Transform::rightAscensionToHourAngle(Coordinate *coord, bool native) {
   if (isnan(coord->r)) return; // NAN flags mount coordinates
-  noInterrupts();
-  unsigned long fs = fracLAST;
-  interrupts();
+  double fs = site.getFracLASTExact();
   coord->h = fsToRad(fs) - coord->r;
   if (native) coord->h = backInRads2(coord->h);
 }
@@ -375,6 +375,7 @@ bool Goto::command(char *reply, char *command, char *parameter, bool *supressFra
         if (parameter[0] == '0') {
           static int star;
           double d;
+          mount.positionCacheInvalidate();
           switch (parameter[1]) {
             case '0': transform.align.model.ax1Cor = arcsecToRad(atol(&parameter[3])); break; // ax1Cor
             case '1': transform.align.model.ax2Cor = arcsecToRad(atol(&parameter[3])); break; // ax2Cor 
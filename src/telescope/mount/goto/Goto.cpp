@@ -11,6 +11,7 @@
 #include "../Mount.h"
 #include "../coordinates/Transform.h"
 #include "../guide/Guide.h"
+#include "../guide/Predict.h"
 #include "../home/Home.h"
 #include "../park/Park.h"
 #include "../limits/Limits.h"
@@ -124,10 +125,28 @@ CommandError Goto::request(Coordinate coords, PierSideSelect pierSideSelect, boo
   start = current;
   destination = target;
 
-  // add waypoint if needed
-  if (transform.mountType != ALTAZM && MFLIP_SKIP_HOME == OFF && start.pierSide != destination.pierSide) {
-    VLF("MSG: Mount, goto changes pier side, setting waypoint at home");
-    waypoint(&current);
+  // add waypoints if needed, a planned path (already checked against the horizon) is preferred
+  waypointCount = 0;
+  waypointNext = 0;
+  bool pierSideChange = transform.mountType != ALTAZM && MFLIP_SKIP_HOME == OFF && start.pierSide != destination.pierSide;
+  meridianFlip = pierSideChange;
+  bool pathBlocked = limits.isHorizonMaskActive() && limits.validatePath(&start, &destination) != CE_NONE;
+  if ((pierSideChange || pathBlocked) && !plan()) {
+    if (pierSideChange) {
+      VLF("MSG: Mount, goto changes pier side, setting waypoint at home");
+      waypoint(&current);
+    }
+
+    // check the goto path against the horizon mask
+    if (limits.isHorizonMaskActive()) {
+      e = limits.validatePath(&start, &destination);
+      if (e == CE_NONE && (stage == GG_WAYPOINT_HOME || stage == GG_WAYPOINT_AVOID)) e = limits.validatePath(&destination, &target);
+      if (e != CE_NONE) {
+        state = GS_NONE;
+        stage = GG_NONE;
+        return e;
+      }
+    }
   }
 
   // start the goto monitor
@@ -198,6 +217,11 @@ CommandError Goto::requestSync(Coordinate coords, PierSideSelect pierSideSelect,
 
   VLF("MSG: Mount, sync instrument coordinates updated");
 
+  // guide corrections learned before the sync no longer apply
+  #if GUIDE_PREDICT == ON
+    guidePredict.reset();
+  #endif
+
   return CE_NONE;
 }
 
@@ -383,6 +407,7 @@ CommandError Goto::alignAddStar() {
     #endif
 
     if (e == CE_NONE) alignState.currentStar++;
+    mount.positionCacheInvalidate();
   }
 
   return e;
@@ -432,6 +457,78 @@ void Goto::waypoint(Coordinate *current) {
   }
 }
 
+// plan the shortest goto path (Mount coordinate system) that stays above the horizon and within
+// the axis and meridian limits, equatorial mounts change pier side (or get around obstructions) through the pole
+// where Axis1 can move freely, returns true if waypoints were set
+bool Goto::plan() {
+  if (transform.mountType == ALTAZM) return false;
+
+  double s1, s2, t1, t2, h1, pole;
+  transform.mountToInstrument(&start, &s1, &s2);
+  transform.mountToInstrument(&target, &t1, &t2);
+  Coordinate homePosition = home.position;
+  transform.mountToInstrument(&homePosition, &h1, &pole);
+
+  // the time for a leg is set by the axis that has the furthest to go
+  #define legDist(a1, a2, b1, b2) fmax(fabs((b1) - (a1)), fabs((b2) - (a2)))
+  double homeDist = legDist(s1, s2, h1, pole) + legDist(h1, pole, t1, t2);
+
+  // try pole crossings at Axis1 positions in order of increasing path length
+  double tried[GOTO_PLAN_CANDIDATES];
+  int triedCount = 0;
+  double best1 = NAN, bestDist = 0.0;
+  while (triedCount < GOTO_PLAN_CANDIDATES) {
+    double c1 = NAN, cDist = 0.0;
+    for (int i = 0; i < GOTO_PLAN_CANDIDATES; i++) {
+      double a1;
+      if (i == 0) a1 = s1; else if (i == 1) a1 = t1; else if (i == 2) a1 = h1; else
+        a1 = axis1.settings.limits.min + ((axis1.settings.limits.max - axis1.settings.limits.min)*(i - 3))/(GOTO_PLAN_CANDIDATES - 4);
+      if (a1 < axis1.settings.limits.min || a1 > axis1.settings.limits.max) continue;
+
+      bool skip = false;
+      for (int j = 0; j < triedCount; j++) if (tried[j] == a1) { skip = true; break; }
+      if (skip) continue;
+
+      double dist = legDist(s1, s2, a1, pole) + legDist(a1, pole, t1, t2);
+      if (isnan(c1) || dist < cDist) { c1 = a1; cDist = dist; }
+    }
+    if (isnan(c1)) break;
+    tried[triedCount++] = c1;
+    Y;
+
+    if (limits.validateLeg(s1, s2, c1, pole) == CE_NONE && limits.validateLeg(c1, pole, t1, t2) == CE_NONE) {
+      best1 = c1;
+      bestDist = cDist;
+      break;
+    }
+  }
+
+  if (!isnan(best1)) {
+    waypoints[0] = transform.instrumentToMount(best1, pole);
+    waypointCount = 1;
+  } else {
+    // fall back to moving Axis2 only to the pole, Axis1 at the pole, then Axis2 only to the target
+    if (limits.validateLeg(s1, s2, s1, pole) != CE_NONE || limits.validateLeg(s1, pole, t1, pole) != CE_NONE ||
+        limits.validateLeg(t1, pole, t1, t2) != CE_NONE) {
+      VLF("MSG: Mount, goto path planning failed");
+      return false;
+    }
+    waypoints[0] = transform.instrumentToMount(s1, pole);
+    waypoints[1] = transform.instrumentToMount(t1, pole);
+    waypointCount = 2;
+    bestDist = fabs(pole - s2) + fabs(t1 - s1) + fabs(t2 - pole);
+  }
+  #undef legDist
+
+  VF("MSG: Mount, goto path planned with "); V(waypointCount); VF(" waypoint(s) ");
+  V(radToDeg(bestDist)); VF(" deg vs "); V(radToDeg(homeDist)); VLF(" deg through home");
+
+  destination = waypoints[0];
+  waypointNext = 1;
+  if (waypointCount > 1) stage = GG_WAYPOINT_AVOID; else stage = GG_WAYPOINT_HOME;
+  return true;
+}
+
 // monitor goto
 void Goto::poll() {
   if (stage == GG_READY_ABORT) {
@@ -464,11 +561,15 @@ void Goto::poll() {
       VLF("MSG: Mount, goto waypoint reached");
       stage = GG_WAYPOINT_HOME;
       destination = home.position;
+      if (waypointNext < waypointCount) {
+        destination = waypoints[waypointNext++];
+        if (waypointNext < waypointCount) stage = GG_WAYPOINT_AVOID;
+      }
       startAutoSlew();
     } else
 
     if (stage == GG_WAYPOINT_HOME) {
-      if (settings.meridianFlipPause && !meridianFlipHome.resume) { meridianFlipHome.paused = true; goto skip; }
+      if (meridianFlip && settings.meridianFlipPause && !meridianFlipHome.resume) { meridianFlipHome.paused = true; goto skip; }
       meridianFlipHome.paused = false;
       meridianFlipHome.resume = false;
 
@@ -514,6 +615,12 @@ void Goto::poll() {
     if (stage == GG_DESTINATION || stage == GG_ABORT) {
       VLF("MSG: Mount, goto destination reached");
       state = GS_NONE;
+
+      // guide corrections learned at the old position no longer apply
+      #if GUIDE_PREDICT == ON
+        guidePredict.reset();
+      #endif
+
       mount.update();
 
       // kill this monitor
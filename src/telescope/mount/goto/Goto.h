@@ -10,6 +10,9 @@
 #include "../coordinates/Transform.h"
 
 enum MeridianFlip: uint8_t     {MF_NEVER, MF_ALWAYS};
+#define GOTO_WAYPOINTS_MAX 2           // waypoints the goto path planner can set
+#define GOTO_PLAN_CANDIDATES 40        // Axis1 positions the goto path planner tries for crossing the pole
+
 enum GotoState: uint8_t        {GS_NONE, GS_GOTO};
 enum GotoStage: uint8_t        {GG_NONE, GG_ABORT, GG_READY_ABORT, GG_WAYPOINT_HOME, GG_WAYPOINT_AVOID, GG_NEAR_DESTINATION_START, GG_NEAR_DESTINATION_WAIT, GG_NEAR_DESTINATION, GG_DESTINATION};
 enum GotoType: uint8_t         {GT_NONE, GT_HOME, GT_PARK};
@@ -115,6 +118,10 @@ class Goto {
     // set any additional destinations required for a goto
     void waypoint(Coordinate *current);
 
+    // plan the shortest goto path that stays above the horizon and within the axis and meridian limits
+    // returns true if waypoints were set
+    bool plan();
+
     // start slews with approach correction and parking/homing support
     CommandError startAutoSlew();
     #endif
@@ -136,6 +143,12 @@ class Goto {
     Coordinate destination;
     // goto final destination Mount coordinate (eq or hor)
     Coordinate target = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, PIER_SIDE_NONE};
+    // goto path planner waypoints Mount coordinate (eq)
+    Coordinate waypoints[GOTO_WAYPOINTS_MAX];
+    uint8_t waypointCount = 0;
+    uint8_t waypointNext = 0;
+    // goto changes pier side, only then is there a meridian flip to pause at
+    bool meridianFlip = false;
     // goto final destination Mount Azimuth coordinate correction for coordinate wrap 
     double azimuthTargetCorrection = 0.0;
     // last align (goto) target Mount coordinate (eq or hor)
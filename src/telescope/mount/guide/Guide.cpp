@@ -16,8 +16,10 @@
 #include "../home/Home.h"
 #include "../limits/Limits.h"
 #include "../status/Status.h"
+#include "Predict.h"
 
 inline void guideWrapper() { guide.poll(); }
+inline void guidePulseWrapper() { guide.pulsePoll(); }
 
 void Guide::init() {
   // confirm the data structure size
@@ -41,6 +43,17 @@ void Guide::init() {
   int taskHandle = tasks.add(0, 0, true, 3, guideWrapper, "MtGuide");
   tasks.setPeriodMicros(taskHandle, FRACTIONAL_SEC_US/2);
   if (taskHandle) { VLF("success"); } else { VLF("FAILED!"); }
+
+  #if GUIDE_PULSE_OFFSET == ON
+    axis1.setOffsetLimit(arcsecToRad(AXIS1_GUIDE_OFFSET_LIMIT));
+    axis2.setOffsetLimit(arcsecToRad(AXIS2_GUIDE_OFFSET_LIMIT));
+  #endif
+
+  // start pulse guide timing task
+  VF("MSG: Mount, start pulse guide timing task (rate "); V(GUIDE_PULSE_POLL_US); VF("us priority 2)... ");
+  taskHandle = tasks.add(0, 0, true, 2, guidePulseWrapper, "MtGdPls");
+  tasks.setPeriodMicros(taskHandle, GUIDE_PULSE_POLL_US);
+  if (taskHandle) { VLF("success"); } else { VLF("FAILED!"); }
 }
 
 // start guide at a given direction and rate on Axis1
@@ -67,6 +80,20 @@ CommandError Guide::startAxis1(GuideAction guideAction, GuideRateSelect rateSele
     state = GU_PULSE_GUIDE;
     if (guideAction == GA_REVERSE) { VF("MSG: Guide, Axis1 rev @"); rateAxis1 = -rate; } else { VF("MSG: Guide, Axis1 fwd @"); rateAxis1 = rate; }
     V(rate); VL("X");
+    pulseAxis1.active = false;
+    offsetAxis1 = false;
+    #if GUIDE_PREDICT == ON
+      if (guideTimeLimit <= GUIDE_PULSE_TIMED_MAX_MS) guidePredict.record(1, rateAxis1, guideTimeLimit);
+    #endif
+    #if GUIDE_PULSE_OFFSET == ON
+      if (guideTimeLimit <= GUIDE_PULSE_TIMED_MAX_MS &&
+          axis1.offset(rateAxis1*siderealToRadF(guideTimeLimit/1000.0F)) == CE_NONE) {
+        VLF("MSG: Guide, Axis1 pulse applied as offset");
+        offsetAxis1 = true;
+        rateAxis1 = 0.0F;
+      }
+    #endif
+    if (!offsetAxis1 && guideTimeLimit <= GUIDE_PULSE_TIMED_MAX_MS) pulseBegin(&pulseAxis1, rateAxis1, guideTimeLimit);
     mount.update();
   } else {
     state = GU_GUIDE;
@@ -88,11 +115,14 @@ void Guide::stopAxis1(GuideAction stopDirection, bool abort) {
 
   if (guideActionAxis1 > GA_BREAK) {
     if (stopDirection != GA_BREAK && guideActionAxis1 != stopDirection && guideActionAxis1 != GA_HOME) return;
+    // offsets are short and always run to completion
+    if (offsetAxis1) return;
     if (rateAxis1 == 0.0F) {
       guideActionAxis1 = GA_BREAK;
       if (abort) axis1.autoSlewAbort(); else axis1.autoSlewStop();
     } else {
       VLF("MSG: Guide, Axis1 stopped");
+      pulseAxis1.active = false;
       guideActionAxis1 = GA_NONE;
       rateAxis1 = 0.0F;
       mount.update();
@@ -127,6 +157,20 @@ CommandError Guide::startAxis2(GuideAction guideAction, GuideRateSelect rateSele
     if (pierSide == PIER_SIDE_WEST) { if (guideAction == GA_FORWARD) guideAction = GA_REVERSE; else guideAction = GA_FORWARD; };
     if (guideAction == GA_REVERSE) { VF("MSG: Guide, Axis2 rev @"); rateAxis2 = -rate; } else { VF("MSG: Guide, Axis2 fwd @"); rateAxis2 = rate; }
     V(rate); VL("X");
+    pulseAxis2.active = false;
+    offsetAxis2 = false;
+    #if GUIDE_PREDICT == ON
+      if (guideTimeLimit <= GUIDE_PULSE_TIMED_MAX_MS) guidePredict.record(2, rateAxis2, guideTimeLimit);
+    #endif
+    #if GUIDE_PULSE_OFFSET == ON
+      if (guideTimeLimit <= GUIDE_PULSE_TIMED_MAX_MS &&
+          axis2.offset(rateAxis2*siderealToRadF(guideTimeLimit/1000.0F)) == CE_NONE) {
+        VLF("MSG: Guide, Axis2 pulse applied as offset");
+        offsetAxis2 = true;
+        rateAxis2 = 0.0F;
+      }
+    #endif
+    if (!offsetAxis2 && guideTimeLimit <= GUIDE_PULSE_TIMED_MAX_MS) pulseBegin(&pulseAxis2, rateAxis2, guideTimeLimit);
     mount.update();
   } else {
     state = GU_GUIDE;
@@ -148,11 +192,14 @@ void Guide::stopAxis2(GuideAction stopDirection, bool abort) {
 
   if (guideActionAxis2 > GA_BREAK) {
     if (stopDirection != GA_BREAK && guideActionAxis2 != stopDirection && guideActionAxis2 != GA_HOME) return;
+    // offsets are short and always run to completion
+    if (offsetAxis2) return;
     if (rateAxis2 == 0.0F) {
       guideActionAxis2 = GA_BREAK;
       if (abort) axis2.autoSlewAbort(); else axis2.autoSlewStop();
     } else {
       VLF("MSG: Guide, Axis2 stopped");
+      pulseAxis2.active = false;
       guideActionAxis2 = GA_NONE;
       rateAxis2 = 0.0F;
       mount.update();
@@ -415,12 +462,16 @@ void Guide::poll() {
   // just return if no guide is active
   if (state == GU_NONE) return;
 
+  // check offset guide completion
+  if (offsetAxis1 && !axis1.isOffsetting()) { offsetAxis1 = false; guideActionAxis1 = GA_NONE; }
+  if (offsetAxis2 && !axis2.isOffsetting()) { offsetAxis2 = false; guideActionAxis2 = GA_NONE; }
+
   // check fast guide completion axis1
   if (guideActionAxis1 == GA_BREAK && rateAxis1 == 0.0F && !axis1.isSlewing()) {
     guideActionAxis1 = GA_NONE;
     mount.update();
   } else {
-    if (guideActionAxis1 > GA_BREAK && (long)(millis() - guideFinishTimeAxis1) >= 0) stopAxis1();
+    if (guideActionAxis1 > GA_BREAK && !pulseAxis1.active && (long)(millis() - guideFinishTimeAxis1) >= 0) stopAxis1();
   }
 
   // check fast guide completion axis2
@@ -428,7 +479,7 @@ void Guide::poll() {
     guideActionAxis2 = GA_NONE;
     mount.update();
   } else {
-    if (guideActionAxis2 > GA_BREAK && (long)(millis() - guideFinishTimeAxis2) >= 0) stopAxis2();
+    if (guideActionAxis2 > GA_BREAK && !pulseAxis2.active && (long)(millis() - guideFinishTimeAxis2) >= 0) stopAxis2();
   }
 
   // do spiral guiding, change rates and stop both axes at once
@@ -455,6 +506,44 @@ void Guide::poll() {
   if (guideActionAxis1 == GA_NONE && guideActionAxis2 == GA_NONE) state = GU_NONE;
 }
 
+// stops timed pulse guides on time
+void Guide::pulsePoll() {
+  if (pulseExpired(&pulseAxis1, rateAxis1)) stopAxis1();
+  if (pulseExpired(&pulseAxis2, rateAxis2)) stopAxis2();
+}
+
+// start timing a pulse guide at rate (in sidereal x) for timeMs, adjusted for the carry
+void Guide::pulseBegin(GuidePulse *pulse, float rate, unsigned long timeMs) {
+  if (rate == 0.0F) return;
+  if ((long)(millis() - pulse->lastTimeMs) > GUIDE_PULSE_CARRY_MS) pulse->carry = 0.0F;
+
+  // an earlier pulse that went long (or short) in this direction makes this one shorter (or longer)
+  pulse->requested = rate*timeMs*1000.0F;
+  float durationUs = (pulse->requested - pulse->carry)/rate;
+  if (durationUs < 0.0F) durationUs = 0.0F;
+  pulse->durationUs = lroundf(durationUs);
+  pulse->startTimeUs = micros();
+  pulse->active = true;
+}
+
+// true if the timed pulse guide is complete, updates the carry
+bool Guide::pulseExpired(GuidePulse *pulse, float rate) {
+  if (!pulse->active) return false;
+  unsigned long elapsedUs = micros() - pulse->startTimeUs;
+  if (elapsedUs < pulse->durationUs) return false;
+
+  VF("MSG: Guide, pulse delivered "); V(elapsedUs); VF("us of "); V(lroundf(pulse->requested/rate)); VLF("us requested");
+
+  pulse->carry += rate*elapsedUs - pulse->requested;
+  float carryLimit = fabs(rate)*GUIDE_PULSE_POLL_US*4.0F;
+  if (pulse->carry > carryLimit) pulse->carry = carryLimit; else
+  if (pulse->carry < -carryLimit) pulse->carry = -carryLimit;
+
+  pulse->active = false;
+  pulse->lastTimeMs = millis();
+  return true;
+}
+
 // enables or disables backlash for the GUIDE_DISABLE_BACKLASH option
 void Guide::backlashEnableControl(bool enable) {
   #if GUIDE_DISABLE_BACKLASH == ON
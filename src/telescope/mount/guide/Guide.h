@@ -16,10 +16,28 @@
 
 // default time for spiral guides is 103.4 seconds
 #define GUIDE_SPIRAL_TIME_LIMIT 103.4
+
+// pulse guides are timed in microseconds by a fast task, any difference between the requested and
+// delivered guide displacement is carried into the next pulse on that axis
+#ifndef GUIDE_PULSE_POLL_US
+  #define GUIDE_PULSE_POLL_US 250
+#endif
+#define GUIDE_PULSE_TIMED_MAX_MS 60000  // longer pulse guides are timed by the guide monitor
+#define GUIDE_PULSE_CARRY_MS 10000      // carry is discarded if the axis hasn't pulse guided for this long
+
 enum GuideState: uint8_t       {GU_NONE, GU_PULSE_GUIDE, GU_GUIDE, GU_SPIRAL_GUIDE, GU_HOME_GUIDE, GU_HOME_GUIDE_ABORT};
 enum GuideRateSelect: uint8_t  {GR_QUARTER, GR_HALF, GR_1X, GR_2X, GR_4X, GR_8X, GR_20X, GR_48X, GR_HALF_MAX, GR_MAX, GR_CUSTOM};
 enum GuideAction: uint8_t      {GA_NONE, GA_BREAK, GA_FORWARD, GA_REVERSE, GA_SPIRAL, GA_HOME };
 
+typedef struct GuidePulse {
+  bool active;
+  unsigned long startTimeUs;
+  unsigned long durationUs;
+  float requested;            // requested displacement in sidereal x microseconds
+  float carry;                // delivered minus requested displacement in sidereal x microseconds
+  unsigned long lastTimeMs;
+} GuidePulse;
+
 #pragma pack(1)
 #define GuideSettingsSize 3
 typedef struct GuideSettings {
@@ -81,6 +99,9 @@ class Guide {
 
     void spiralPoll();
 
+    // stops timed pulse guides on time
+    void pulsePoll();
+
     // enables or disables backlash for the GUIDE_DISABLE_BACKLASH option
     void backlashEnableControl(bool enable);
 
@@ -113,6 +134,12 @@ class Guide {
     // start axis2 movement
     void axis2AutoSlew(GuideAction guideAction);
 
+    // start timing a pulse guide at rate (in sidereal x) for timeMs, adjusted for the carry
+    void pulseBegin(GuidePulse *pulse, float rate, unsigned long timeMs);
+
+    // true if the timed pulse guide is complete, updates the carry
+    bool pulseExpired(GuidePulse *pulse, float rate);
+
     GuideRateSelect spiralGuideRateSelect = GR_20X;
     
     GuideAction guideActionAxis1 = GA_NONE;
@@ -129,6 +156,13 @@ class Guide {
     unsigned long guideFinishTimeAxis1 = 0;
     unsigned long guideFinishTimeAxis2 = 0;
 
+    GuidePulse pulseAxis1 = {false, 0, 0, 0.0F, 0.0F, 0};
+    GuidePulse pulseAxis2 = {false, 0, 0, 0.0F, 0.0F, 0};
+
+    // pulse guides being applied as a position offset (GUIDE_PULSE_OFFSET)
+    bool offsetAxis1 = false;
+    bool offsetAxis2 = false;
+
 };
 
 extern Guide guide;
@@ -0,0 +1,49 @@
+//--------------------------------------------------------------------------------------------------
+// telescope mount control, guide correction predictor commands
+
+#include "Predict.h"
+
+#ifdef MOUNT_PRESENT
+
+#if GUIDE_PREDICT == ON
+
+#include "../../../lib/convert/Convert.h"
+
+bool GuidePredict::command(char *reply, char *command, char *parameter, bool *supressFrame, bool *numericReply, CommandError *commandError) {
+  *supressFrame = false;
+  *commandError = CE_NONE;
+
+  if (command[0] == 'G' && command[1] == 'X' && parameter[0] == 'P' && parameter[2] == 0) {
+    // :GXP0#     Get guide predictor enabled
+    //            Returns: 0 or 1#
+    if (parameter[1] == '0') {
+      sprintf(reply, "%d", enabled ? 1 : 0);
+      *numericReply = false;
+    } else
+
+    // :GXP[n]#   Get guide predictor state for Axis[n] where n = 1 or 2
+    //            Returns: c,r,e# where c is the count of guide corrections, r the predicted rate, and e the rms fit error (both in x sidereal)
+    if (parameter[1] == '1' || parameter[1] == '2') {
+      GuidePredictModel *model = (parameter[1] == '1') ? &axis1Model : &axis2Model;
+      char rate[12], rms[12];
+      sprintF(rate, "%1.5f", (parameter[1] == '1') ? rateAxis1 : rateAxis2);
+      sprintF(rms, "%1.5f", model->rms);
+      sprintf(reply, "%d,%s,%s", (int)model->count, rate, rms);
+      *numericReply = false;
+    } else *commandError = CE_CMD_UNKNOWN;
+  } else
+
+  // :SXP0,[n]# Set guide predictor [n] = 0 disabled, 1 enabled, 2 forget the guide corrections
+  //            Return: 0 on failure or 1 on success
+  if (command[0] == 'S' && command[1] == 'X' && parameter[0] == 'P' && parameter[1] == '0' && parameter[2] == ',') {
+    if (parameter[3] == '0' && parameter[4] == 0) { enabled = false; rateAxis1 = 0.0F; rateAxis2 = 0.0F; } else
+    if (parameter[3] == '1' && parameter[4] == 0) enabled = true; else
+    if (parameter[3] == '2' && parameter[4] == 0) reset(); else *commandError = CE_PARAM_RANGE;
+  } else return false;
+
+  return true;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,224 @@
+//--------------------------------------------------------------------------------------------------
+// telescope mount control, guide correction predictor
+
+#include "Predict.h"
+
+#ifdef MOUNT_PRESENT
+
+#if GUIDE_PREDICT == ON
+
+#include "../../../lib/tasks/OnTask.h"
+
+#include "../Mount.h"
+#include "../goto/Goto.h"
+#include "../pec/Pec.h"
+#include "Guide.h"
+
+inline void guidePredictWrapper() { guidePredict.poll(); }
+
+void GuidePredict::init() {
+  resetModel(&axis1Model);
+  resetModel(&axis2Model);
+
+  #if AXIS1_PEC == ON
+    float stepsPerSiderealSecond = (axis1.getStepsPerMeasure()/RAD_DEG_RATIO_F)/240.0F;
+    if (stepsPerSiderealSecond > 0.0F) wormPeriodS = pec.settings.wormRotationSteps/stepsPerSiderealSecond;
+  #endif
+  axis1Model.periodic = GUIDE_PREDICT_HARMONICS > 0 && wormPeriodS > 0.0F;
+  axis2Model.periodic = false;
+  VF("MSG: Mount, guide predictor worm period "); V(wormPeriodS); VLF("s");
+
+  VF("MSG: Mount, start guide predictor task (rate "); V(GUIDE_PREDICT_POLL_MS); VF("ms priority 7)... ");
+  if (tasks.add(GUIDE_PREDICT_POLL_MS, 0, true, 7, guidePredictWrapper, "MtGdPrd")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+// record a pulse guide on axis (1 or 2) at rate (in x sidereal, +/-) for timeMs
+void GuidePredict::record(int axis, float rate, unsigned long timeMs) {
+  GuidePredictModel *model = (axis == 1) ? &axis1Model : &axis2Model;
+  float phase = (axis == 1) ? wormPhase() : 0.0F;
+  unsigned long now = millis();
+
+  if (model->lastTimeMs != 0) {
+    float span = (now - model->lastTimeMs)/1000.0F;
+    if (span > 0.0F && span <= GUIDE_PREDICT_SPAN_MAX_S) {
+      // the worm phase midway between this and the last guide correction
+      float delta = phase - model->lastPhase;
+      if (delta > (float)Deg180) delta -= (float)Deg360; else if (delta < -(float)Deg180) delta += (float)Deg360;
+
+      model->head = (model->head + 1) % GUIDE_PREDICT_SAMPLES;
+      GuidePredictSample *sample = &model->sample[model->head];
+      sample->phase = model->lastPhase + delta/2.0F;
+      sample->span = span;
+      sample->value = rate*(timeMs/1000.0F) + model->accPredicted;
+      if (model->count < GUIDE_PREDICT_SAMPLES) model->count++;
+      model->refit = true;
+    }
+  }
+
+  model->lastPhase = phase;
+  model->accPredicted = 0.0F;
+  model->lastTimeMs = now;
+  if (model->lastTimeMs == 0) model->lastTimeMs = 1;
+}
+
+// forget all guide corrections and stop predicting
+void GuidePredict::reset() {
+  resetModel(&axis1Model);
+  resetModel(&axis2Model);
+  rateAxis1 = 0.0F;
+  rateAxis2 = 0.0F;
+}
+
+void GuidePredict::poll() {
+  unsigned long now = millis();
+  float elapsed = (now - lastPollMs)/1000.0F;
+  lastPollMs = now;
+
+  // only predict while tracking at the sidereal rate and pulse guiding (or not guiding)
+  if (!enabled || !mount.isTracking() || guide.state > GU_PULSE_GUIDE || goTo.state != GS_NONE) {
+    axis1Model.lastTimeMs = 0;
+    axis2Model.lastTimeMs = 0;
+    rateAxis1 = 0.0F;
+    rateAxis2 = 0.0F;
+    return;
+  }
+
+  // the worm and the drift are different on the other side of the pier
+  PierSide pierSide = mount.getPosition(CR_MOUNT).pierSide;
+  if (pierSide != lastPierSide) {
+    if (lastPierSide != PIER_SIDE_NONE) { VLF("MSG: Mount, guide predictor reset for pier side change"); }
+    reset();
+    lastPierSide = pierSide;
+  }
+
+  // keep track of the correction the prediction made since the last guide correction
+  if (axis1Model.lastTimeMs != 0) axis1Model.accPredicted += rateAxis1*elapsed;
+  if (axis2Model.lastTimeMs != 0) axis2Model.accPredicted += rateAxis2*elapsed;
+
+  if (axis1Model.refit) fit(&axis1Model);
+  Y;
+  if (axis2Model.refit) fit(&axis2Model);
+
+  rateAxis1 = predict(&axis1Model, wormPhase());
+  rateAxis2 = predict(&axis2Model, 0.0F);
+}
+
+// worm phase for Axis1 in radians, 0 if the worm period isn't known
+float GuidePredict::wormPhase() {
+  #if AXIS1_PEC == ON
+    if (pec.settings.wormRotationSteps > 0) {
+      long steps = axis1.getMotorPositionSteps() % pec.settings.wormRotationSteps;
+      if (steps < 0) steps += pec.settings.wormRotationSteps;
+      return ((float)steps/pec.settings.wormRotationSteps)*(float)Deg360;
+    }
+  #endif
+  return 0.0F;
+}
+
+// refit the model from the guide corrections
+void GuidePredict::fit(GuidePredictModel *model) {
+  const int n = GUIDE_PREDICT_TERMS;
+  int terms = model->periodic ? n : 1;
+  model->refit = false;
+
+  if (model->count < GUIDE_PREDICT_MIN_SAMPLES || model->count < terms*4) { model->valid = false; return; }
+
+  // weighted least squares normal equations, each correction is the predicted rate integrated over its span
+  float a[GUIDE_PREDICT_TERMS][GUIDE_PREDICT_TERMS + 1];
+  for (int i = 0; i < terms; i++) for (int j = 0; j <= terms; j++) a[i][j] = 0.0F;
+
+  float x[GUIDE_PREDICT_TERMS];
+  int used = 0;
+  for (int k = 0; k < model->count; k++) {
+    GuidePredictSample *sample = &model->sample[(model->head + GUIDE_PREDICT_SAMPLES - k) % GUIDE_PREDICT_SAMPLES];
+
+    // drop outliers once a fit exists
+    if (model->valid && model->rms > 0.0F) {
+      float residual = sample->value/sample->span - predict(model, sample->phase);
+      if (fabs(residual) > GUIDE_PREDICT_OUTLIER*model->rms) continue;
+    }
+
+    basis(model, sample->phase, x);
+    for (int i = 0; i < terms; i++) {
+      x[i] *= sample->span;
+      for (int j = 0; j < terms; j++) a[i][j] += x[i]*x[j];
+      a[i][terms] += x[i]*sample->value;
+    }
+    used++;
+  }
+  if (used < terms*4) { model->valid = false; return; }
+
+  // solve by Gaussian elimination with partial pivoting
+  for (int c = 0; c < terms; c++) {
+    int p = c;
+    for (int r = c + 1; r < terms; r++) if (fabs(a[r][c]) > fabs(a[p][c])) p = r;
+    if (fabs(a[p][c]) < 1.0E-9F) { model->valid = false; return; }
+    if (p != c) for (int j = 0; j <= terms; j++) { float t = a[c][j]; a[c][j] = a[p][j]; a[p][j] = t; }
+    for (int r = c + 1; r < terms; r++) {
+      float f = a[r][c]/a[c][c];
+      for (int j = c; j <= terms; j++) a[r][j] -= f*a[c][j];
+    }
+  }
+  for (int c = terms - 1; c >= 0; c--) {
+    float s = a[c][terms];
+    for (int j = c + 1; j < terms; j++) s -= a[c][j]*model->term[j];
+    model->term[c] = s/a[c][c];
+  }
+  for (int c = terms; c < n; c++) model->term[c] = 0.0F;
+  model->valid = true;
+
+  // rms of the residual rates for outlier rejection
+  float sum = 0.0F;
+  for (int k = 0; k < model->count; k++) {
+    GuidePredictSample *sample = &model->sample[(model->head + GUIDE_PREDICT_SAMPLES - k) % GUIDE_PREDICT_SAMPLES];
+    float residual = sample->value/sample->span - predict(model, sample->phase);
+    sum += residual*residual;
+  }
+  model->rms = sqrtf(sum/model->count);
+}
+
+// the model's predicted rate at the worm phase, in x sidereal
+float GuidePredict::predict(GuidePredictModel *model, float phase) {
+  if (!model->valid) return 0.0F;
+
+  float x[GUIDE_PREDICT_TERMS];
+  basis(model, phase, x);
+  float rate = 0.0F;
+  for (int i = 0; i < GUIDE_PREDICT_TERMS; i++) rate += model->term[i]*x[i];
+
+  if (rate > GUIDE_PREDICT_RATE_MAX) rate = GUIDE_PREDICT_RATE_MAX; else
+  if (rate < -GUIDE_PREDICT_RATE_MAX) rate = -GUIDE_PREDICT_RATE_MAX;
+  return rate;
+}
+
+// the model's basis functions at the worm phase
+void GuidePredict::basis(GuidePredictModel *model, float phase, float *x) {
+  x[0] = 1.0F;
+  for (int h = 1; h <= GUIDE_PREDICT_HARMONICS; h++) {
+    if (model->periodic) {
+      x[h*2 - 1] = sinf(h*phase);
+      x[h*2] = cosf(h*phase);
+    } else {
+      x[h*2 - 1] = 0.0F;
+      x[h*2] = 0.0F;
+    }
+  }
+}
+
+void GuidePredict::resetModel(GuidePredictModel *model) {
+  model->head = 0;
+  model->count = 0;
+  model->valid = false;
+  model->refit = false;
+  for (int i = 0; i < GUIDE_PREDICT_TERMS; i++) model->term[i] = 0.0F;
+  model->rms = 0.0F;
+  model->accPredicted = 0.0F;
+  model->lastPhase = 0.0F;
+  model->lastTimeMs = 0;
+}
+
+GuidePredict guidePredict;
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+//--------------------------------------------------------------------------------------------------
+// telescope mount control, guide correction predictor
+#pragma once
+
+#include "../../../Common.h"
+
+#ifdef MOUNT_PRESENT
+
+#if GUIDE_PREDICT == ON
+
+#include "../../../libApp/commands/ProcessCmds.h"
+#include "../coordinates/Transform.h"
+
+// the predictor fits the guide corrections seen on each axis to a drift rate plus (on Axis1) harmonics
+// of the worm period, the fitted rate is then added to tracking so the autoguider only corrects what's left
+#ifndef GUIDE_PREDICT_SAMPLES
+  #define GUIDE_PREDICT_SAMPLES 128       // guide corrections remembered per axis
+#endif
+#ifndef GUIDE_PREDICT_HARMONICS
+  #define GUIDE_PREDICT_HARMONICS 2       // worm period harmonics fit on Axis1, 0 to 3 (needs PEC_STEPS_PER_WORM_ROTATION)
+#endif
+#ifndef GUIDE_PREDICT_MIN_SAMPLES
+  #define GUIDE_PREDICT_MIN_SAMPLES 20    // guide corrections needed before a prediction is used
+#endif
+#ifndef GUIDE_PREDICT_RATE_MAX
+  #define GUIDE_PREDICT_RATE_MAX 0.1F     // largest predicted rate in x sidereal
+#endif
+#define GUIDE_PREDICT_POLL_MS 250         // rate at which the prediction is updated
+#define GUIDE_PREDICT_SPAN_MAX_S 30.0F    // longer gaps between guide corrections aren't recorded
+#define GUIDE_PREDICT_OUTLIER 3.0F        // corrections this many rms from the fit are ignored (wind gusts, etc.)
+#define GUIDE_PREDICT_TERMS (1 + GUIDE_PREDICT_HARMONICS*2)
+
+typedef struct GuidePredictSample {
+  float phase;                // worm phase at the middle of the span, in radians
+  float span;                 // time since the last guide correction, in seconds
+  float value;                // guide plus predicted correction over the span, in x sidereal seconds
+} GuidePredictSample;
+
+typedef struct GuidePredictModel {
+  GuidePredictSample sample[GUIDE_PREDICT_SAMPLES];
+  uint16_t head;
+  uint16_t count;
+  bool periodic;              // fit harmonics of the worm period
+  bool valid;                 // enough samples for the fit to be used
+  bool refit;                 // new samples since the last fit
+  float term[GUIDE_PREDICT_TERMS];
+  float rms;                  // rms of the fit residuals in x sidereal
+  float accPredicted;         // predicted correction since the last guide correction, in x sidereal seconds
+  float lastPhase;            // worm phase at the last guide correction, in radians
+  unsigned long lastTimeMs;   // time of the last guide correction, 0 if none
+} GuidePredictModel;
+
+class GuidePredict {
+  public:
+    void init();
+
+    bool command(char *reply, char *command, char *parameter, bool *supressFrame, bool *numericReply, CommandError *commandError);
+
+    // record a pulse guide on axis (1 or 2) at rate (in x sidereal, +/-) for timeMs
+    void record(int axis, float rate, unsigned long timeMs);
+
+    // forget all guide corrections and stop predicting
+    void reset();
+
+    void poll();
+
+    // predicted tracking rate offsets (in x sidereal)
+    float rateAxis1 = 0.0F;
+    float rateAxis2 = 0.0F;
+
+    bool enabled = true;
+
+  private:
+    // worm phase for Axis1 in radians, 0 if the worm period isn't known
+    float wormPhase();
+
+    // refit the model from the guide corrections
+    void fit(GuidePredictModel *model);
+
+    // the model's predicted rate at the worm phase, in x sidereal
+    float predict(GuidePredictModel *model, float phase);
+
+    // the model's basis functions at the worm phase
+    void basis(GuidePredictModel *model, float phase, float *x);
+
+    void resetModel(GuidePredictModel *model);
+
+    GuidePredictModel axis1Model;
+    GuidePredictModel axis2Model;
+
+    float wormPeriodS = 0.0F;
+    unsigned long lastPollMs = 0;
+    PierSide lastPierSide = PIER_SIDE_NONE;
+};
+
+extern GuidePredict guidePredict;
+
+#endif
+
+#endif
@@ -30,6 +30,17 @@ bool Limits::command(char *reply, char *command, char *parameter, bool *supressF
       *numericReply=false;
     } else
 
+    // :GXH[c]#   Get horizon mask altitude for azimuth bin [c] = 0-9,A-Z (0 to 350 degrees in 10 degree steps)
+    //            Returns: sDD.D# or N# if the bin has no mask
+    if (command[1] == 'X' && parameter[0] == 'H' && parameter[2] == 0) {
+      int bin = -1;
+      if (parameter[1] >= '0' && parameter[1] <= '9') bin = parameter[1] - '0'; else
+      if (parameter[1] >= 'A' && parameter[1] <= 'Z') bin = parameter[1] - 'A' + 10;
+      if (bin < 0) { *commandError = CE_PARAM_RANGE; return true; }
+      if (horizonMask.altitude[bin] == HORIZON_MASK_NONE) strcpy(reply, "N"); else sprintF(reply, "%+1.1f", horizonMask.altitude[bin]/2.0F);
+      *numericReply = false;
+    } else
+
     // :GXE[m]#   Get Other Limit [m]
     //            Returns: n#
     if (command[1] == 'X' && parameter[0] == 'E' && parameter[2] == 0) {
@@ -77,6 +88,23 @@ bool Limits::command(char *reply, char *command, char *parameter, bool *supressF
       } else *commandError = CE_PARAM_FORM;
     } else
 
+    //  :SXH[c],[sDD.D]#
+    //            Set horizon mask altitude for azimuth bin [c] = 0-9,A-Z (0 to 350 degrees in 10 degree steps)
+    //            to [sDD.D] degrees (-63.5 to +63.5) or N to remove the mask from this bin
+    //            Return: 0 on failure or 1 on success
+    if (command[1] == 'X' && parameter[0] == 'H' && parameter[2] == ',') {
+      int bin = -1;
+      if (parameter[1] >= '0' && parameter[1] <= '9') bin = parameter[1] - '0'; else
+      if (parameter[1] >= 'A' && parameter[1] <= 'Z') bin = parameter[1] - 'A' + 10;
+      if (bin < 0) { *commandError = CE_PARAM_RANGE; return true; }
+      if (parameter[3] == 'N' && parameter[4] == 0) horizonMask.altitude[bin] = HORIZON_MASK_NONE; else {
+        float degs = atof(&parameter[3]);
+        if (degs >= -63.5F && degs <= 63.5F) horizonMask.altitude[bin] = lroundf(degs*2.0F); else { *commandError = CE_PARAM_RANGE; return true; }
+      }
+      nv.updateBytes(NV_MOUNT_HORIZON_BASE, &horizonMask, sizeof(HorizonMask));
+      horizonMaskUpdate();
+    } else
+
     //  :SXE9,[n]#
     //  :SXEA,[n]#
     //            Set meridian limit east (9) or west (A) to value [n] in minutes
@@ -30,9 +30,19 @@ void Limits::init() {
 
   constrainMeridianLimits();
 
+  // horizon mask
+  if (HorizonMaskSize < sizeof(HorizonMask)) { nv.initError = true; DL("ERR: Limits::init(), HorizonMaskSize error"); }
+  if (!nv.hasValidKey()) {
+    VLF("MSG: Mount, horizon mask writing defaults to NV");
+    for (int i = 0; i < HORIZON_MASK_BINS; i++) horizonMask.altitude[i] = HORIZON_MASK_NONE;
+    nv.writeBytes(NV_MOUNT_HORIZON_BASE, &horizonMask, sizeof(HorizonMask));
+  }
+  nv.readBytes(NV_MOUNT_HORIZON_BASE, &horizonMask, sizeof(HorizonMask));
+  horizonMaskUpdate();
+
   // start limit monitor task
-  VF("MSG: Mount, limits start monitor task (rate 100ms priority 2)... ");
-  if (tasks.add(100, 0, true, 2, limitsWrapper, "MntLmt")) { VLF("success"); } else { VLF("FAILED!"); }
+  VF("MSG: Mount, limits start monitor task (rate "); V(LIMITS_POLL_MS); VF("ms priority 2)... ");
+  if (tasks.add(LIMITS_POLL_MS, 0, true, 2, limitsWrapper, "MntLmt")) { VLF("success"); } else { VLF("FAILED!"); }
 }
 
 // constrain meridian limits to the allowed range
@@ -90,6 +100,178 @@ CommandError Limits::validateTarget(Coordinate *coords) {
   return CE_NONE;
 }
 
+// goto path check from one position to another (Mount coordinate system) against the horizon
+CommandError Limits::validatePath(Coordinate *from, Coordinate *to) {
+  double fromA1, fromA2, toA1, toA2;
+  transform.mountToInstrument(from, &fromA1, &fromA2);
+  transform.mountToInstrument(to, &toA1, &toA2);
+  return validatePath(fromA1, fromA2, toA1, toA2);
+}
+
+// goto path check from one position to another (instrument coordinates) against the horizon
+CommandError Limits::validatePath(double fromA1, double fromA2, double toA1, double toA2) {
+  // both axes are assumed to move at the same rate, so the axis with less to travel arrives first
+  double d1 = toA1 - fromA1;
+  double d2 = toA2 - fromA2;
+  double dMax = fmax(fabs(d1), fabs(d2));
+  if (dMax == 0.0) return CE_NONE;
+
+  // starting below the horizon (parked, etc.) is allowed so long as the path doesn't go any lower
+  Coordinate point = transform.instrumentToMount(fromA1, fromA2);
+  if (transform.mountType != ALTAZM) transform.equToHor(&point);
+  float originMargin = point.a - horizonAltitude(point.z);
+  if (originMargin > 0.0F) originMargin = 0.0F;
+
+  for (int i = 1; i <= HORIZON_PATH_SAMPLES; i++) {
+    double s = (dMax*i)/HORIZON_PATH_SAMPLES;
+    double s1 = fmin(s, fabs(d1)), s2 = fmin(s, fabs(d2));
+    point = transform.instrumentToMount(fromA1 + ((d1 < 0.0) ? -s1 : s1), fromA2 + ((d2 < 0.0) ? -s2 : s2));
+    if (transform.mountType != ALTAZM) transform.equToHor(&point);
+    if (point.a - horizonAltitude(point.z) < originMargin) {
+      VF("MSG: Mount, validate failed path below horizon at Azm "); V(radToDeg(point.z)); VF(" Alt "); VL(radToDeg(point.a));
+      return CE_SLEW_ERR_BELOW_HORIZON;
+    }
+  }
+  return CE_NONE;
+}
+
+// goto path planner leg check (instrument coordinates) against the axis min/max limits, the
+// meridian limits and the horizon
+CommandError Limits::validateLeg(double fromA1, double fromA2, double toA1, double toA2) {
+  // the axis limits are a box in instrument coordinates, so a leg ending inside stays inside
+  if (flt(toA1, axis1.settings.limits.min) || fgt(toA1, axis1.settings.limits.max) ||
+      flt(toA2, axis2.settings.limits.min) || fgt(toA2, axis2.settings.limits.max)) return CE_SLEW_ERR_OUTSIDE_LIMITS;
+
+  if (transform.meridianFlips) {
+    double d1 = toA1 - fromA1;
+    double d2 = toA2 - fromA2;
+    double dMax = fmax(fabs(d1), fabs(d2));
+
+    // a meridian flip starts past the limit, that's allowed so long as the leg doesn't go any further
+    Coordinate point = transform.instrumentToMount(fromA1, fromA2);
+    double originPast = pastMeridianLimit(&point);
+    if (originPast < 0.0) originPast = 0.0;
+
+    for (int i = 1; i <= HORIZON_PATH_SAMPLES && dMax > 0.0; i++) {
+      double s = (dMax*i)/HORIZON_PATH_SAMPLES;
+      double s1 = fmin(s, fabs(d1)), s2 = fmin(s, fabs(d2));
+      point = transform.instrumentToMount(fromA1 + ((d1 < 0.0) ? -s1 : s1), fromA2 + ((d2 < 0.0) ? -s2 : s2));
+      if (pastMeridianLimit(&point) > originPast) {
+        VF("MSG: Mount, validate failed path past meridian limit at HA "); VL(radToDeg(point.h));
+        return CE_SLEW_ERR_OUTSIDE_LIMITS;
+      }
+    }
+  }
+
+  return validatePath(fromA1, fromA2, toA1, toA2);
+}
+
+// how far past the meridian limit for its pier side a position (Mount coordinate system) is, in radians
+double Limits::pastMeridianLimit(Coordinate *coords) {
+  if (coords->pierSide == PIER_SIDE_EAST) return -settings.pastMeridianE - coords->h;
+  if (coords->pierSide == PIER_SIDE_WEST) return coords->h - settings.pastMeridianW;
+  return -Deg360;
+}
+
+// horizon altitude at azimuth z, the horizon mask or horizon limit whichever is higher
+float Limits::horizonAltitude(double z) {
+  if (!horizonMaskActive) return settings.altitude.min;
+
+  float f = fmod(z, Deg360);
+  if (f < 0.0F) f += (float)Deg360;
+  f /= (float)Deg10;
+  int bin = (int)f;
+  float fraction = f - bin;
+  bin %= HORIZON_MASK_BINS;
+
+  float altitude = horizonMaskBin(bin)*(1.0F - fraction) + horizonMaskBin((bin + 1) % HORIZON_MASK_BINS)*fraction;
+  altitude = degToRadF(altitude/2.0F);
+  if (altitude < settings.altitude.min) altitude = settings.altitude.min;
+  return altitude;
+}
+
+// update the horizon mask highest altitude and slope
+void Limits::horizonMaskUpdate() {
+  horizonMaskActive = false;
+  float highest = -180.0F;
+  float steepest = 0.0F;
+  for (int i = 0; i < HORIZON_MASK_BINS; i++) {
+    if (horizonMask.altitude[i] != HORIZON_MASK_NONE) horizonMaskActive = true;
+    float altitude = horizonMaskBin(i);
+    if (altitude > highest) highest = altitude;
+    float slope = fabs(horizonMaskBin((i + 1) % HORIZON_MASK_BINS) - altitude);
+    if (slope > steepest) steepest = slope;
+  }
+  horizonMaskMax = degToRadF(highest/2.0F);
+  if (horizonMaskMax < settings.altitude.min) horizonMaskMax = settings.altitude.min;
+  horizonMaskSlope = degToRadF(steepest/2.0F)/(float)Deg10;
+  altitudeCheckCycles = 0;
+}
+
+// altitude (in half degrees) for horizon mask bin, bins without a mask return the horizon limit
+float Limits::horizonMaskBin(int bin) {
+  if (horizonMask.altitude[bin] == HORIZON_MASK_NONE) return radToDegF(settings.altitude.min)*2.0F;
+  return horizonMask.altitude[bin];
+}
+
+// distance the axes can move before an altitude limit could be reached, in radians
+float Limits::altitudeMargin(Coordinate *current) {
+  float marginMax = settings.altitude.max - current->a;
+  float marginMin = current->a - settings.altitude.min;
+  if (horizonMaskActive) {
+    // above the highest point of the mask azimuth doesn't matter, below it the mask
+    // can rise toward us as quickly as the azimuth changes
+    float marginTop = current->a - horizonMaskMax;
+    float cosAlt = cosf(current->a);
+    if (cosAlt < 0.2F) cosAlt = 0.2F;
+    float marginMask = (current->a - horizonAltitude(current->z))/(1.0F + horizonMaskSlope/cosAlt);
+    marginMin = fmax(marginTop, marginMask);
+  }
+  float margin = fmin(marginMin, marginMax);
+  if (margin < 0.0F) margin = 0.0F;
+
+  // the axis to sky motion isn't exact (alignment model, refraction) so keep well inside the margin
+  return margin/2.0F;
+}
+
+// starts a controlled stop for slewing axes that would otherwise overshoot a meridian or axis limit
+void Limits::predictiveStop(Coordinate *current) {
+  // gotos (and guides home) have validated targets and ramp down on arrival, so only guide slews are checked
+  #if GOTO_FEATURE == ON
+    if (goTo.state != GS_NONE) return;
+  #endif
+  if (guide.state == GU_HOME_GUIDE || guide.state == GU_HOME_GUIDE_ABORT) return;
+
+  // the distance covered before coming to rest, including travel until the next limits poll
+  if (axis1.isSlewing()) {
+    float frequency = axis1.getFrequencyCommanded();
+    float reach = axis1.getStoppingDistance() + fabs(frequency)*(LIMITS_POLL_MS/1000.0F);
+    if (frequency > 0.0F) {
+      bool stop = fgt(current->a1 + reach, axis1.settings.limits.max);
+      if (transform.meridianFlips && current->pierSide == PIER_SIDE_WEST && current->h + reach > settings.pastMeridianW) stop = true;
+      if (stop) { VLF("MSG: Limits, Axis1 forward stopping ahead of limit"); guide.stopAxis1(GA_FORWARD, false); }
+    } else
+    if (frequency < 0.0F) {
+      bool stop = flt(current->a1 - reach, axis1.settings.limits.min);
+      if (transform.meridianFlips && current->pierSide == PIER_SIDE_EAST && current->h - reach < -settings.pastMeridianE) stop = true;
+      if (stop) { VLF("MSG: Limits, Axis1 reverse stopping ahead of limit"); guide.stopAxis1(GA_REVERSE, false); }
+    }
+  }
+
+  if (axis2.isSlewing() && AXIS2_TANGENT_ARM == OFF) {
+    float frequency = axis2.getFrequencyCommanded();
+    float reach = axis2.getStoppingDistance() + fabs(frequency)*(LIMITS_POLL_MS/1000.0F);
+    if (frequency > 0.0F && fgt(current->a2 + reach, axis2.settings.limits.max)) {
+      VLF("MSG: Limits, Axis2 forward stopping ahead of limit");
+      guide.stopAxis2((current->pierSide == PIER_SIDE_EAST) ? GA_FORWARD : GA_REVERSE, false);
+    } else
+    if (frequency < 0.0F && flt(current->a2 - reach, axis2.settings.limits.min)) {
+      VLF("MSG: Limits, Axis2 reverse stopping ahead of limit");
+      guide.stopAxis2((current->pierSide == PIER_SIDE_EAST) ? GA_REVERSE : GA_FORWARD, false);
+    }
+  }
+}
+
 // true if an error exists
 bool Limits::isError() {
   return initError.nv ||
@@ -180,12 +362,30 @@ void Limits::poll() {
 
   LimitsError lastError = error;
 
-  Coordinate current = mount.getMountPosition(CR_MOUNT_ALT);
+  // altitude isn't calculated while the axes haven't moved far enough to reach an altitude limit
+  double a1 = axis1.getInstrumentCoordinate();
+  double a2 = axis2.getInstrumentCoordinate();
+  bool altitudeCheck = !limitsEnabled || altitudeCheckCycles == 0 ||
+                       fabs(a1 - altitudeCheckA1) + fabs(a2 - altitudeCheckA2) >= altitudeCheckMargin;
+
+  Coordinate current;
+  if (!altitudeCheck) current = mount.getMountPosition(CR_MOUNT); else
+  if (horizonMaskActive) current = mount.getMountPosition(CR_MOUNT_HOR); else current = mount.getMountPosition(CR_MOUNT_ALT);
 
   if (limitsEnabled) {
     // overhead and horizon limits
-    if (current.a < settings.altitude.min) error.altitude.min = true; else error.altitude.min = false;
-    if (current.a > settings.altitude.max) error.altitude.max = true; else error.altitude.max = false;
+    if (altitudeCheck) {
+      float horizon = horizonMaskActive ? horizonAltitude(current.z) : settings.altitude.min;
+      if (current.a < horizon) error.altitude.min = true; else error.altitude.min = false;
+      if (current.a > settings.altitude.max) error.altitude.max = true; else error.altitude.max = false;
+
+      altitudeCheckMargin = altitudeMargin(&current);
+      altitudeCheckA1 = a1;
+      altitudeCheckA2 = a2;
+      altitudeCheckCycles = HORIZON_CHECK_CYCLES;
+    } else altitudeCheckCycles--;
+
+    predictiveStop(&current);
 
     // meridian limits
     if (transform.meridianFlips && current.pierSide == PIER_SIDE_EAST) {
@@ -279,6 +479,7 @@ void Limits::poll() {
       error.limit.axis2.max = true;
     } else error.limit.axis2.max = false;
   } else {
+    altitudeCheckCycles = 0;
     error.altitude.min = false;
     error.altitude.max = false;
     error.limit.axis1.min = false;
@@ -8,6 +8,13 @@
 
 #include "../guide/Guide.h"
 
+// the horizon mask has 10 degree azimuth bins starting at north (0 degrees) and increasing toward the east
+#define HORIZON_MASK_BINS 36
+#define HORIZON_MASK_NONE -128        // bin has no mask, the horizon limit applies
+#define HORIZON_CHECK_CYCLES 20       // full altitude checks happen at least this often, in limit polls
+#define HORIZON_PATH_SAMPLES 24       // points checked along each goto path segment
+#define LIMITS_POLL_MS 100            // limits monitor rate
+
 #pragma pack(1)
 typedef struct AltitudeLimits {
   float min;
@@ -20,6 +27,11 @@ typedef struct LimitSettings {
   float pastMeridianE;
   float pastMeridianW;
 } LimitSettings;
+
+#define HorizonMaskSize 36
+typedef struct HorizonMask {
+  int8_t altitude[HORIZON_MASK_BINS];  // in half degrees
+} HorizonMask;
 #pragma pack()
 
 typedef struct MerdianError {
@@ -56,6 +68,25 @@ class Limits {
     // target coordinate check ahead of sync, goto, etc.
     CommandError validateTarget(Coordinate *coords);
 
+    // goto path check from one position to another (Mount coordinate system) against the horizon
+    CommandError validatePath(Coordinate *from, Coordinate *to);
+
+    // goto path check from one position to another (instrument coordinates) against the horizon
+    CommandError validatePath(double fromA1, double fromA2, double toA1, double toA2);
+
+    // goto path planner leg check (instrument coordinates) against the axis min/max limits, the
+    // meridian limits and the horizon
+    CommandError validateLeg(double fromA1, double fromA2, double toA1, double toA2);
+
+    // horizon altitude at azimuth z, the horizon mask or horizon limit whichever is higher
+    float horizonAltitude(double z);
+
+    // how far past the meridian limit for its pier side a position (Mount coordinate system) is, in radians
+    double pastMeridianLimit(Coordinate *coords);
+
+    // true if any horizon mask bin is set
+    inline bool isHorizonMaskActive() { return horizonMaskActive; }
+
     // true if an limit related error is exists
     bool isError();
 
@@ -79,12 +110,35 @@ class Limits {
     LimitSettings settings = { { degToRadF(-10.0F), degToRadF(80.0F) }, degToRadF(15.0F), degToRadF(15.0F) };
 
   private:
+    // update the horizon mask highest altitude and slope
+    void horizonMaskUpdate();
+
+    // altitude (in half degrees) for horizon mask bin, bins without a mask return the horizon limit
+    float horizonMaskBin(int bin);
+
+    // distance the axes can move before an altitude limit could be reached, in radians
+    float altitudeMargin(Coordinate *current);
+
+    // starts a controlled stop for slewing axes that would otherwise overshoot a meridian or axis limit
+    void predictiveStop(Coordinate *current);
+
     void stop();
     void stopAxis1(GuideAction stopDirection = GA_BREAK);
     void stopAxis2(GuideAction stopDirection = GA_BREAK);
 
     bool limitsEnabled = false;
     LimitsError error;
+
+    HorizonMask horizonMask;
+    bool horizonMaskActive = false;
+    float horizonMaskMax = 0.0F;
+    float horizonMaskSlope = 0.0F;
+
+    // the altitude checks are skipped until the axes move further than the margin from where they were last done
+    float altitudeCheckMargin = 0.0F;
+    double altitudeCheckA1 = 0.0;
+    double altitudeCheckA2 = 0.0;
+    uint8_t altitudeCheckCycles = 0;
 };
 
 extern Limits limits;
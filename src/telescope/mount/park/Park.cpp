@@ -240,6 +240,7 @@ CommandError Park::restore(bool withTrackingOn) {
     // load the pointing model
     #if ALIGN_MAX_NUM_STARS > 1  
       transform.align.modelRead();
+      mount.positionCacheInvalidate();
     #endif
 
     // get the park coordinate ready
@@ -84,6 +84,7 @@
           #else
             VLF("MSG: Mount, PEC adding sense");
             senseHandle = sense.add(PEC_SENSE_PIN, PEC_SENSE_INIT, PEC_SENSE);
+            sense.setLatch(senseHandle, axis1.getMotorStepsSource());
           #endif
 
           VF("MSG: Mount, PEC start monitor task (rate 10ms priority 3)... ");
@@ -113,11 +114,18 @@
       lastState = wormIndexState;
       wormIndexState = sense.isOn(senseHandle);
 
+      // an interrupt driven sense gives the step position at the index edge, even if it came and went since the last poll
+      // the latch doesn't count backlash, while tracking that doesn't change so add it back in as it is now
+      unsigned long edgeTimeUs;
+      long edgeSteps;
+      bool edgeSeen = sense.edge(senseHandle, true, &edgeTimeUs, &edgeSteps);
+      if (edgeSeen) edgeSteps += axis1.getBacklashPositionSteps();
+
       // digital or analog pec sense, with 60 second delay before redetect
       long dist; if (wormSenseSteps > axis1Steps) dist = wormSenseSteps - axis1Steps; else dist = axis1Steps - wormSenseSteps;
-      if (dist > stepsPerSiderealSecond*60.0 && wormIndexState != lastState && wormIndexState == true) {
+      if (dist > stepsPerSiderealSecond*60.0 && (edgeSeen || (wormIndexState != lastState && wormIndexState == true))) {
         VLF("MSG: Mount, PEC index detected");
-        wormSenseSteps = axis1Steps;
+        wormSenseSteps = edgeSeen ? edgeSteps : axis1Steps;
         wormSenseFirst = true;
         bufferStart = true;
         wormIndexSenseThisSecond = true;
@@ -145,9 +153,7 @@
     #endif
 
     // handle playing back and recording PEC
-    noInterrupts();
-    unsigned long lastFs = fracLAST;
-    interrupts();
+    unsigned long lastFs = site.getFracLAST();
 
     // start playing PEC
     if (settings.state == PEC_READY_PLAY) {
@@ -13,9 +13,9 @@
 #include "../limits/Limits.h"
 #include "../Mount.h"
 
-// fractional second sidereal clock (fracsec or millisecond)
-volatile unsigned long fracLAST;
-IRAM_ATTR void clockTickWrapper() { fracLAST++; }
+#define SITE_CLOCK_POLL_MS 1000
+
+inline void clockPollWrapper() { site.clockPoll(); }
 
 #define fsToHours(x) ((x)/(3600.0*FRACTIONAL_SEC))
 #define hoursToFs(x) ((x)*(3600.0*FRACTIONAL_SEC))
@@ -126,18 +126,11 @@ void Site::init() {
     readJD();
   #endif
 
+  setSiderealPeriod(SIDEREAL_PERIOD);
   setSiderealTime(ut1);
 
-  VF("MSG: Mount, site start sidereal timer task (rate 10ms priority 0)... ");
-  delay(100);
-  // period ms (0=idle), duration ms (0=forever), repeat, priority (highest 0..7 lowest), task_handle
-  taskHandle = tasks.add(0, 0, true, 0, clockTickWrapper, "ClkTick");
-  if (taskHandle) {
-    VLF("success"); 
-    if (!tasks.requestHardwareTimer(taskHandle, 1)) { DLF("WRN: Site::init(), didn't get h/w timer for Clock (using s/w timer)"); }
-  } else { VLF("FAILED!"); }
-
-  setSiderealPeriod(SIDEREAL_PERIOD);
+  VF("MSG: Mount, site start sidereal clock task (rate "); V(SITE_CLOCK_POLL_MS); VF("ms priority 7)... ");
+  if (tasks.add(SITE_CLOCK_POLL_MS, 0, true, 7, clockPollWrapper, "SdClock")) { VLF("success"); } else { VLF("FAILED!"); }
 
   #if TIME_LOCATION_PPS_SENSE != OFF
     pps.init();
@@ -154,6 +147,8 @@ void Site::updateLocation() {
   // same date and time, just calculates the sidereal time again
   ut1.hour = getTime();
   setSiderealTime(ut1);
+
+  mount.positionCacheInvalidate();
 }
 
 // update the TLS 
@@ -194,11 +189,7 @@ void Site::setDateTime(JulianDate julianDate) {
 
 // gets the time in sidereal hours
 double Site::getSiderealTime() {
-  long fs;
-  noInterrupts();
-  fs = fracLAST;
-  interrupts();
-  return rangeHours(fsToHours(fs));
+  return rangeHours(fsToHours(fmod(getFracLASTExact(), hoursToFs(24.0))));
 }
 
 // sets the UT time (in hours) that have passed in this Julian Day
@@ -218,16 +209,82 @@ unsigned long Site::getSiderealPeriod() {
 
 // sets sidereal period, in sub-micro counts per second
 void Site::setSiderealPeriod(unsigned long period) {
+  noInterrupts();
+  clockRebase();
   siderealPeriod = period;
-  tasks.setPeriodSubMicros(taskHandle, lround(siderealPeriod/FRACTIONAL_SEC));
+  clockScale();
+  interrupts();
 }
 
-// gets the time in hours that have passed since Julian Day was set (UT1)
-double Site::getTime() {
-  unsigned long cs;
+// gets the sidereal clock, in fractional seconds (fracsec or millisecond)
+unsigned long Site::getFracLAST() {
+  uint64_t elapsedMicros;
+  double epochFrac, fsPerMicro;
+  noInterrupts();
+  clockRead(&elapsedMicros, &epochFrac, &fsPerMicro);
+  unsigned long epochFs = clockEpochFs;
+  interrupts();
+  return epochFs + (unsigned long)clockElapsedFs(elapsedMicros, epochFrac, fsPerMicro);
+}
+
+// gets the sidereal clock, in fractional seconds including the part of the current one
+double Site::getFracLASTExact() {
+  uint64_t elapsedMicros;
+  double epochFrac, fsPerMicro;
   noInterrupts();
-  cs = fracLAST;
+  clockRead(&elapsedMicros, &epochFrac, &fsPerMicro);
+  unsigned long epochFs = clockEpochFs;
   interrupts();
+  return (double)epochFs + clockElapsedFs(elapsedMicros, epochFrac, fsPerMicro);
+}
+
+// keeps the sidereal clock time base extended and follows changes to the task period ratio (PPS)
+void Site::clockPoll() {
+  noInterrupts();
+  if (clockPeriodRatio != tasks.getPeriodRatioSubMicros()) { clockRebase(); clockScale(); } else clockMicros();
+  interrupts();
+}
+
+// gets the sidereal clock time base in microseconds, interrupts must be disabled
+uint64_t Site::clockMicros() {
+  // micros() wraps about every 71 minutes, clockPoll() makes sure we see every wrap
+  unsigned long us = micros();
+  if (us < clockLastMicros) clockMicrosHigh++;
+  clockLastMicros = us;
+  return ((uint64_t)clockMicrosHigh << 32) | us;
+}
+
+// copies the sidereal clock state needed to read it, interrupts must be disabled
+// the (software on some MCUs) double math is left to the caller once interrupts are enabled again
+void Site::clockRead(uint64_t *elapsedMicros, double *epochFrac, double *fsPerMicro) {
+  *elapsedMicros = clockMicros() - clockEpochMicros;
+  *epochFrac = clockEpochFrac;
+  *fsPerMicro = clockFsPerMicro;
+}
+
+// moves the sidereal clock epoch to now so the scale can change without the clock jumping, interrupts must be disabled
+void Site::clockRebase() {
+  uint64_t elapsedMicros;
+  double epochFrac, fsPerMicro;
+  clockRead(&elapsedMicros, &epochFrac, &fsPerMicro);
+  double fs = clockElapsedFs(elapsedMicros, epochFrac, fsPerMicro);
+  double whole = floor(fs);
+  clockEpochMicros = clockMicros();
+  clockEpochFs += (unsigned long)whole;
+  clockEpochFrac = fs - whole;
+}
+
+// sets the sidereal clock scale from the sidereal period and task period ratio
+void Site::clockScale() {
+  clockPeriodRatio = tasks.getPeriodRatioSubMicros();
+  if (siderealPeriod == 0 || clockPeriodRatio == 0) { clockFsPerMicro = 0.0; return; }
+  // a sidereal second is siderealPeriod sub-micros, which is siderealPeriod*ratio/16M local sub-micros
+  clockFsPerMicro = (16.0*16000000.0*FRACTIONAL_SEC)/((double)siderealPeriod*clockPeriodRatio);
+}
+
+// gets the time in hours that have passed since Julian Day was set (UT1)
+double Site::getTime() {
+  unsigned long cs = getFracLAST();
   return fracHOUR + fsToHours((cs - fracSTART)/SIDEREAL_RATIO);
 }
 
@@ -237,7 +294,9 @@ void Site::setLAST(JulianDate julianDate, double time) {
   fracHOUR = julianDate.hour;
   fracSTART = fs;
   noInterrupts();
-  fracLAST = fs;
+  clockEpochMicros = clockMicros();
+  clockEpochFs = fs;
+  clockEpochFrac = 0.0;
   interrupts();
 }
 
@@ -12,8 +12,6 @@
 #include "../../../lib/tls/Tls.h"
 #include "../../../lib/tls/PPS.h"
 
-extern volatile unsigned long fracLAST;
-
 typedef struct LatitudeExtras {
   double sine;
   double cosine;
@@ -74,8 +72,14 @@ class Site {
     // slower rates are < 1.0, faster rates are > 1.0
     inline float getSiderealRatio() { return (float)SIDEREAL_PERIOD/siderealPeriod; }
 
-    // callback to tick the fracsec sidereal frac
-    void tick();
+    // gets the sidereal clock, in fractional seconds (fracsec or millisecond)
+    unsigned long getFracLAST();
+
+    // gets the sidereal clock, in fractional seconds including the part of the current one
+    double getFracLASTExact();
+
+    // keeps the sidereal clock time base extended and follows changes to the task period ratio (PPS)
+    void clockPoll();
 
     Location location;
     LocationExtras locationEx;
@@ -93,6 +97,23 @@ class Site {
     // sets the time in sidereal hours
     void setLAST(JulianDate julianDate, double time);
 
+    // gets the sidereal clock time base in microseconds, interrupts must be disabled
+    uint64_t clockMicros();
+
+    // copies the sidereal clock state needed to read it, interrupts must be disabled
+    void clockRead(uint64_t *elapsedMicros, double *epochFrac, double *fsPerMicro);
+
+    // gets the sidereal clock in fractional seconds past the epoch from a clockRead()
+    inline double clockElapsedFs(uint64_t elapsedMicros, double epochFrac, double fsPerMicro) {
+      return (double)elapsedMicros*fsPerMicro + epochFrac;
+    }
+
+    // moves the sidereal clock epoch to now so the scale can change without the clock jumping, interrupts must be disabled
+    void clockRebase();
+
+    // sets the sidereal clock scale from the sidereal period and task period ratio
+    void clockScale();
+
     // convert julian date/time to local apparent sidereal time
     double julianDateToLAST(JulianDate julianDate);
 
@@ -135,8 +156,15 @@ class Site {
     // sidereal period in sub-microsecond counts
     unsigned long siderealPeriod = 0;
 
-    // handle to sidereal timer LAST task
-    uint8_t taskHandle = 0;
+    // sidereal clock, fractional seconds are counted from a free running 64-bit microsecond time base
+    // scaled by the sidereal period and task period ratio, so no timer or ISR is needed to keep it
+    uint64_t clockEpochMicros = 0;
+    unsigned long clockEpochFs = 0;
+    double clockEpochFrac = 0.0;
+    double clockFsPerMicro = 0.0;
+    unsigned long clockPeriodRatio = 16000000UL;
+    unsigned long clockLastMicros = 0;
+    uint32_t clockMicrosHigh = 0;
 
     // site number 0..3
     uint8_t locationNumber = 0;
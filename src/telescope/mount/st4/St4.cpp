@@ -138,25 +138,25 @@
             int r = (int)guide.settings.axis1RateSelect;
             if (st4Axis1Fwd.wasPressed() && !st4Axis1Rev.wasPressed()) {
               #if GOTO_FEATURE == ON
-                if (goTo.state == GS_NONE) SERIAL_LOCAL.transmit(":B+#"); else { if (r >= 7) r=8; else if (r >= 5) r=7; else if (r >= 2) r=5; else if (r < 2) r=2; }
+                if (goTo.state == GS_NONE) SERIAL_LOCAL.transmit(":B+#", false); else { if (r >= 7) r=8; else if (r >= 5) r=7; else if (r >= 2) r=5; else if (r < 2) r=2; }
               #else
-                SERIAL_LOCAL.transmit(":B+#");
+                SERIAL_LOCAL.transmit(":B+#", false);
               #endif
               mountStatus.soundClick();
             }
             if (st4Axis1Rev.wasPressed() && !st4Axis1Fwd.wasPressed()) {
               #if GOTO_FEATURE == ON
-                if (goTo.state == GS_NONE) SERIAL_LOCAL.transmit(":B-#"); else { if (r <= 5) r=2; else if (r <= 7) r=5; else if (r <= 8) r=7; else if (r > 8) r=8; }
+                if (goTo.state == GS_NONE) SERIAL_LOCAL.transmit(":B-#", false); else { if (r <= 5) r=2; else if (r <= 7) r=5; else if (r <= 8) r=7; else if (r > 8) r=8; }
               #else
-                SERIAL_LOCAL.transmit(":B-#");
+                SERIAL_LOCAL.transmit(":B-#", false);
               #endif
               mountStatus.soundClick();
             }
             if (st4Axis2Rev.wasPressed() && !st4Axis2Fwd.wasPressed()) {
               #if GOTO_FEATURE == ON
-                if (goTo.alignDone()) SERIAL_LOCAL.transmit(":CS#"); else goTo.alignAddStar();
+                if (goTo.alignDone()) SERIAL_LOCAL.transmit(":CS#", false); else goTo.alignAddStar();
               #else
-                SERIAL_LOCAL.transmit(":CS#");
+                SERIAL_LOCAL.transmit(":CS#", false);
               #endif
               mountStatus.soundClick();
             }
@@ -170,31 +170,31 @@
               static int fs = 0;
               static int fn = 0;
               if (!fn && !fs) {
-                if (st4Axis1Fwd.wasPressed() && !st4Axis1Rev.wasPressed()) { SERIAL_LOCAL.transmit(":F2#"); mountStatus.soundClick(); }
-                if (st4Axis1Rev.wasPressed() && !st4Axis1Fwd.wasPressed()) { SERIAL_LOCAL.transmit(":F1#"); mountStatus.soundClick(); }
+                if (st4Axis1Fwd.wasPressed() && !st4Axis1Rev.wasPressed()) { SERIAL_LOCAL.transmit(":F2#", false); mountStatus.soundClick(); }
+                if (st4Axis1Rev.wasPressed() && !st4Axis1Fwd.wasPressed()) { SERIAL_LOCAL.transmit(":F1#", false); mountStatus.soundClick(); }
               }
               if (!fn) {
                 if (st4Axis2Rev.isDown() && st4Axis2Fwd.isUp()) {
-                  if (fs == 0) { SERIAL_LOCAL.transmit(":FS#"); fs++; } else
-                  if (fs == 1) { SERIAL_LOCAL.transmit(":F-#"); fs++; } else
-                  if (fs == 2 && st4Axis2Rev.timeDown() > 4000) { SERIAL_LOCAL.transmit(":FF#"); fs++; } else
-                  if (fs == 3) { SERIAL_LOCAL.transmit(":F-#"); fs++; }
+                  if (fs == 0) { SERIAL_LOCAL.transmit(":FS#", false); fs++; } else
+                  if (fs == 1) { SERIAL_LOCAL.transmit(":F-#", false); fs++; } else
+                  if (fs == 2 && st4Axis2Rev.timeDown() > 4000) { SERIAL_LOCAL.transmit(":FF#", false); fs++; } else
+                  if (fs == 3) { SERIAL_LOCAL.transmit(":F-#", false); fs++; }
                 }
-                if (st4Axis2Rev.isUp()) { if (fs > 0) { SERIAL_LOCAL.transmit(":FQ#"); fs = 0; } }
+                if (st4Axis2Rev.isUp()) { if (fs > 0) { SERIAL_LOCAL.transmit(":FQ#", false); fs = 0; } }
               }
               if (!fs) {
                 if (st4Axis2Fwd.isDown() && st4Axis2Rev.isUp()) {
-                  if (fn == 0) { SERIAL_LOCAL.transmit(":FS#"); fn++; } else
-                  if (fn == 1) { SERIAL_LOCAL.transmit(":F+#"); fn++; } else
-                  if (fn == 2 && st4Axis2Fwd.timeDown() > 4000) { SERIAL_LOCAL.transmit(":FF#"); fn++; } else
-                  if (fn == 3) { SERIAL_LOCAL.transmit(":F+#"); fn++; }
+                  if (fn == 0) { SERIAL_LOCAL.transmit(":FS#", false); fn++; } else
+                  if (fn == 1) { SERIAL_LOCAL.transmit(":F+#", false); fn++; } else
+                  if (fn == 2 && st4Axis2Fwd.timeDown() > 4000) { SERIAL_LOCAL.transmit(":FF#", false); fn++; } else
+                  if (fn == 3) { SERIAL_LOCAL.transmit(":F+#", false); fn++; }
                 }
-                if (st4Axis2Fwd.isUp()) { if (fn > 0) { SERIAL_LOCAL.transmit(":FQ#"); fn = 0; } }
+                if (st4Axis2Fwd.isUp()) { if (fn > 0) { SERIAL_LOCAL.transmit(":FQ#", false); fn = 0; } }
               }
             #else
-              if (st4Axis1Fwd.wasPressed() && !st4Axis1Rev.wasPressed()) { SERIAL_LOCAL.transmit(":LN#"); mountStatus.soundClick(); }
-              if (st4Axis1Rev.wasPressed() && !st4Axis1Fwd.wasPressed()) { SERIAL_LOCAL.transmit(":LB#"); mountStatus.soundClick(); }
-              if (st4Axis2Fwd.wasPressed() && !st4Axis2Rev.wasPressed()) { SERIAL_LOCAL.transmit(":LIG#"); mountStatus.soundClick(); }
+              if (st4Axis1Fwd.wasPressed() && !st4Axis1Rev.wasPressed()) { SERIAL_LOCAL.transmit(":LN#", false); mountStatus.soundClick(); }
+              if (st4Axis1Rev.wasPressed() && !st4Axis1Fwd.wasPressed()) { SERIAL_LOCAL.transmit(":LB#", false); mountStatus.soundClick(); }
+              if (st4Axis2Fwd.wasPressed() && !st4Axis2Rev.wasPressed()) { SERIAL_LOCAL.transmit(":LIG#", false); mountStatus.soundClick(); }
               if (st4Axis2Rev.wasPressed() && !st4Axis2Fwd.wasPressed()) { mountStatus.soundClick(); mountStatus.soundToggleEnable(); mountStatus.soundClick(); }
             #endif
           }
@@ -202,7 +202,7 @@
       } else {
         if (altModeA || altModeB) { 
           #if ST4_HAND_CONTROL_FOCUSER == ON
-            SERIAL_LOCAL.transmit(":FQ#");
+            SERIAL_LOCAL.transmit(":FQ#", false);
           #endif
           altModeA = false;
           altModeB = false;